@@ -0,0 +1,55 @@
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+/**
+ * Minimal benchmarking helpers shared by the bench/ executables
+ *
+ * Each .cpp under bench/ builds into its own binary (see `make bench`).
+ * Results are printed as aligned rows so runs can be diffed or
+ * appended to bench_output.txt.
+ */
+namespace Bench {
+
+using Clock = std::chrono::high_resolution_clock;
+
+/**
+ * Prevent the optimizer from discarding a computed value
+ */
+template<typename T>
+inline void doNotOptimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * Run fn `repeats` times and return the best wall time in milliseconds
+ * Best-of-N filters out scheduler noise better than the mean does
+ */
+template<typename Fn>
+double bestOfMs(int repeats, Fn&& fn) {
+    double best = 0.0;
+    for (int i = 0; i < repeats; ++i) {
+        auto start = Clock::now();
+        fn();
+        auto end = Clock::now();
+        double ms = std::chrono::duration<double, std::milli>(end - start).count();
+        if (i == 0 || ms < best) {
+            best = ms;
+        }
+    }
+    return best;
+}
+
+inline void printHeader(const std::string& title) {
+    std::printf("\n== %s ==\n", title.c_str());
+    std::printf("%-28s %10s %12s %14s\n", "case", "n", "time (ms)", "ops/sec");
+}
+
+inline void printRow(const std::string& label, size_t n, double ms, size_t ops) {
+    double opsPerSec = ms > 0.0 ? static_cast<double>(ops) / (ms / 1000.0) : 0.0;
+    std::printf("%-28s %10zu %12.3f %14.3e\n", label.c_str(), n, ms, opsPerSec);
+}
+
+} // namespace Bench
@@ -0,0 +1,96 @@
+#include "Bench.hpp"
+#include "../include/AABBBatch.hpp"
+#include "../include/SpatialPartition.hpp"
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * AABB overlap kernel benchmark: scalar pairs vs batched SoA
+ *
+ * Tests every pair within a group of n boxes, the shape of a grid cell's
+ * inner loop, three ways:
+ * - pairwise AABBUtils::intersects on glm::vec3 (the old cell loop)
+ * - AABBBatch::overlapMaskScalar (SoA layout, no SIMD)
+ * - AABBBatch::overlapMask (the compiled SIMD kernel)
+ * Rates are pair tests per second. Build with -mavx2 to get the AVX2
+ * kernel; the default x86-64 build uses SSE2.
+ */
+
+namespace {
+
+std::vector<CAABB> makeBounds(size_t count, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> position(0.0f, 10.0f);
+    std::uniform_real_distribution<float> halfSize(0.2f, 1.0f);
+    std::vector<CAABB> bounds(count);
+    for (CAABB& aabb : bounds) {
+        glm::vec3 center(position(rng), position(rng), position(rng));
+        aabb.min = center - glm::vec3(halfSize(rng));
+        aabb.max = center + glm::vec3(halfSize(rng));
+    }
+    return bounds;
+}
+
+void run(size_t groupSize, size_t groupCount) {
+    std::vector<std::vector<CAABB>> groups;
+    for (size_t g = 0; g < groupCount; ++g) {
+        groups.push_back(makeBounds(groupSize, static_cast<unsigned>(g + 1)));
+    }
+    size_t pairTests = groupCount * groupSize * (groupSize - 1) / 2;
+    std::string n = std::to_string(groupSize);
+
+    size_t hits = 0;
+    double scalarMs = Bench::bestOfMs(5, [&]() {
+        hits = 0;
+        for (const auto& bounds : groups) {
+            for (size_t i = 0; i < bounds.size(); ++i) {
+                for (size_t j = i + 1; j < bounds.size(); ++j) {
+                    hits += AABBUtils::intersects(bounds[i], bounds[j]);
+                }
+            }
+        }
+        Bench::doNotOptimize(hits);
+    });
+    Bench::printRow("pairwise  n=" + n, pairTests, scalarMs, pairTests);
+    size_t expectedHits = hits;
+
+    // Batched variants refill the SoA block per group, as the grid does per cell
+    AABBBatch batch;
+    auto runBatched = [&](bool simd) {
+        hits = 0;
+        for (const auto& bounds : groups) {
+            batch.clear();
+            for (const CAABB& aabb : bounds) {
+                batch.push_back(aabb);
+            }
+            for (size_t i = 0; i < bounds.size(); ++i) {
+                for (size_t block = i + 1; block < bounds.size(); block += AABBBatch::BATCH_WIDTH) {
+                    uint32_t mask = simd ? batch.overlapMask(bounds[i], block)
+                                         : batch.overlapMaskScalar(bounds[i], block);
+                    hits += static_cast<size_t>(__builtin_popcount(mask));
+                }
+            }
+        }
+        Bench::doNotOptimize(hits);
+    };
+
+    double soaMs = Bench::bestOfMs(5, [&]() { runBatched(false); });
+    Bench::printRow("soa scalar n=" + n, pairTests, soaMs, pairTests);
+    double simdMs = Bench::bestOfMs(5, [&]() { runBatched(true); });
+    Bench::printRow(std::string(AABBBatch::kernelName()) + "      n=" + n, pairTests, simdMs, pairTests);
+
+    if (hits != expectedHits) {
+        std::printf("  MISMATCH: %zu vs %zu overlaps\n", hits, expectedHits);
+    }
+}
+
+} // namespace
+
+int main() {
+    Bench::printHeader(std::string("AABB overlap kernels (") + AABBBatch::kernelName() + ")");
+    run(8, 20000);
+    run(32, 2000);
+    run(256, 40);
+    return 0;
+}
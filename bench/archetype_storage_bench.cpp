@@ -0,0 +1,60 @@
+#include "Bench.hpp"
+#include "../include/ComponentManager.hpp"
+#include "../include/Component.h"
+
+/**
+ * Sparse-set vs archetype storage benchmark
+ *
+ * 100k entities carry CTransform3D + CMovement3D, a quarter also CAABB.
+ * Measures a two-component view update and an add/remove churn pass in
+ * both ComponentStorageMode backends.
+ */
+
+namespace {
+
+constexpr size_t ENTITY_COUNT = 100000;
+constexpr float DT = 1.0f / 60.0f;
+
+void populate(ComponentManager& manager) {
+    for (size_t id = 0; id < ENTITY_COUNT; ++id) {
+        manager.addComponent<CTransform3D>(id, glm::vec3(static_cast<float>(id)), glm::vec3(0.0f), glm::vec3(1.0f));
+        manager.addComponent<CMovement3D>(id, glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(0.0f, -1.0f, 0.0f));
+        if (id % 4 == 0) {
+            manager.addComponent<CAABB>(id);
+        }
+    }
+}
+
+void run(const char* label, ComponentStorageMode mode) {
+    ComponentManager manager(mode);
+    populate(manager);
+
+    double viewMs = Bench::bestOfMs(10, [&]() {
+        manager.view<CTransform3D, CMovement3D>().each(
+            [](size_t, CTransform3D& transform, CMovement3D& movement) {
+                movement.vel += movement.acc * DT;
+                transform.position += movement.vel * DT;
+            });
+    });
+    Bench::printRow(std::string(label) + " view<T, M>", ENTITY_COUNT, viewMs, ENTITY_COUNT);
+
+    // Toggle CAABB on every 8th entity (structural change)
+    double churnMs = Bench::bestOfMs(5, [&]() {
+        for (size_t id = 1; id < ENTITY_COUNT; id += 8) {
+            manager.addComponent<CAABB>(id);
+        }
+        for (size_t id = 1; id < ENTITY_COUNT; id += 8) {
+            manager.removeComponent<CAABB>(id);
+        }
+    });
+    Bench::printRow(std::string(label) + " add+remove", ENTITY_COUNT, churnMs, ENTITY_COUNT / 4);
+}
+
+} // namespace
+
+int main() {
+    Bench::printHeader("Component storage backends, 100k entities");
+    run("sparse set", ComponentStorageMode::SPARSE_SET);
+    run("archetype ", ComponentStorageMode::ARCHETYPE);
+    return 0;
+}
@@ -0,0 +1,169 @@
+#include "Bench.hpp"
+#include "../include/CollisionDetectionSystem.hpp"
+#include "../include/PartitionSync.hpp"
+#include "../include/EntityManager.h"
+#include "../include/Component.h"
+#include <cmath>
+#include <random>
+
+/**
+ * Collision broadphase scaling benchmark
+ *
+ * Unit-sized AABBs scattered at constant density (world grows with N).
+ * Times CollisionDetectionSystem::detectCollisions (uniform grid
+ * broadphase) from 1k to 50k entities and compares it with the former
+ * all-pairs loop where that is still affordable. The printed exponent
+ * is log(t2/t1) / log(n2/n1) between consecutive sizes: ~1 is linear,
+ * 2 is quadratic.
+ *
+ * A second table times only keeping the broadphase registered for one
+ * frame: the old clear + reinsert rebuild versus PartitionSync with all,
+ * 10%, or none of the entities moving.
+ */
+
+namespace {
+
+constexpr float HALF_EXTENT = 0.5f;
+constexpr float VOLUME_PER_ENTITY = 8.0f;  // Average free space around each box
+constexpr float CELL_SIZE = 2.0f;
+constexpr size_t BRUTE_FORCE_LIMIT = 10000;
+
+struct Scene {
+    EntityManager entityManager;
+    float worldHalfSize = 0.0f;
+};
+
+void populate(Scene& scene, size_t count) {
+    scene.worldHalfSize = 0.5f * std::cbrt(VOLUME_PER_ENTITY * static_cast<float>(count));
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> coord(-scene.worldHalfSize, scene.worldHalfSize);
+
+    for (size_t i = 0; i < count; ++i) {
+        auto e = scene.entityManager.addEntity(EntityTag::TRIANGLE);
+        e->add<CTransform3D>(glm::vec3(coord(rng), coord(rng), coord(rng)), glm::vec3(0.0f), glm::vec3(1.0f));
+        e->add<CAABB>(glm::vec3(0.0f), glm::vec3(HALF_EXTENT));
+    }
+    scene.entityManager.update();
+}
+
+size_t bruteForce(EntityManager& entityManager, CollisionDetectionSystem& system) {
+    const auto& entities = entityManager.getEntities();
+    size_t hits = 0;
+    for (size_t i = 0; i < entities.size(); ++i) {
+        const CAABB& a = entities[i]->get<CAABB>();
+        for (size_t j = i + 1; j < entities.size(); ++j) {
+            if (system.checkAABBCollision(a, entities[j]->get<CAABB>())) {
+                hits++;
+            }
+        }
+    }
+    return hits;
+}
+
+bool worldBounds(const CTransform3D& transform, const CAABB& aabb, CAABB& out) {
+    out.min = aabb.min + transform.position;
+    out.max = aabb.max + transform.position;
+    return true;
+}
+
+// Nudge every `stride`-th entity by a small step (stride 0: nothing moves)
+void moveEntities(EntityManager& entityManager, size_t stride, float step) {
+    if (stride == 0) {
+        return;
+    }
+    const auto& entities = entityManager.getEntities();
+    for (size_t i = 0; i < entities.size(); i += stride) {
+        entities[i]->get<CTransform3D>().position.x += step;
+    }
+}
+
+void benchRegistration(size_t n) {
+    Scene scene;
+    populate(scene, n);
+    float bound = scene.worldHalfSize + 2.0f;
+    auto partition = createSpatialPartition(PartitionType::UNIFORM_GRID,
+                                            glm::vec3(-bound), glm::vec3(bound), CELL_SIZE);
+
+    float step = 0.01f;
+    double rebuildMs = Bench::bestOfMs(5, [&]() {
+        moveEntities(scene.entityManager, 1, step);
+        step = -step;
+        partition->clear();
+        scene.entityManager.view<CTransform3D, CAABB>().each(
+            [&](size_t id, const CTransform3D& transform, CAABB& aabb) {
+                CAABB world;
+                worldBounds(transform, aabb, world);
+                partition->insert(id, world);
+            });
+    });
+    Bench::printRow("clear + reinsert (all moving)", n, rebuildMs, n);
+
+    auto sync = PartitionSync::attach(*partition, scene.entityManager);
+    sync->sync(scene.entityManager, worldBounds);
+
+    const struct { const char* label; size_t stride; } cases[] = {
+        {"incremental, all moving", 1},
+        {"incremental, 10% moving", 10},
+        {"incremental, static", 0},
+    };
+    for (const auto& c : cases) {
+        double syncMs = Bench::bestOfMs(5, [&]() {
+            moveEntities(scene.entityManager, c.stride, step);
+            step = -step;
+            sync->sync(scene.entityManager, worldBounds);
+        });
+        Bench::printRow(c.label, n, syncMs, n);
+    }
+}
+
+} // namespace
+
+int main() {
+    const size_t sizes[] = {1000, 5000, 10000, 25000, 50000};
+
+    Bench::printHeader("detectCollisions, constant density AABBs");
+
+    double previousMs = 0.0;
+    size_t previousN = 0;
+    for (size_t n : sizes) {
+        Scene scene;
+        populate(scene, n);
+
+        float bound = scene.worldHalfSize + 1.0f;
+        CollisionDetectionSystem system(PartitionType::UNIFORM_GRID,
+                                        glm::vec3(-bound), glm::vec3(bound), CELL_SIZE);
+
+        size_t pairs = 0;
+        double gridMs = Bench::bestOfMs(5, [&]() {
+            pairs = system.detectCollisions(scene.entityManager).size();
+        });
+        Bench::printRow("grid broadphase", n, gridMs, n);
+
+        if (n <= BRUTE_FORCE_LIMIT) {
+            size_t expected = 0;
+            double bruteMs = Bench::bestOfMs(1, [&]() {
+                expected = bruteForce(scene.entityManager, system);
+            });
+            Bench::printRow("all pairs (narrowphase only)", n, bruteMs, n);
+            if (expected != pairs) {
+                std::printf("MISMATCH: broadphase %zu pairs, all-pairs %zu\n", pairs, expected);
+                return 1;
+            }
+        }
+
+        if (previousN > 0 && previousMs > 0.0) {
+            double exponent = std::log(gridMs / previousMs) / std::log(static_cast<double>(n) / previousN);
+            std::printf("  %zu pairs, growth exponent vs %zu: %.2f\n", pairs, previousN, exponent);
+        } else {
+            std::printf("  %zu pairs\n", pairs);
+        }
+        previousMs = gridMs;
+        previousN = n;
+    }
+
+    Bench::printHeader("Per-frame broadphase registration");
+    for (size_t n : {10000, 50000}) {
+        benchRegistration(n);
+    }
+    return 0;
+}
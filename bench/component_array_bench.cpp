@@ -0,0 +1,98 @@
+#include "Bench.hpp"
+#include "../include/ComponentManager.hpp"
+#include "../include/Component.h"
+#include <numeric>
+#include <random>
+#include <unordered_map>
+
+/**
+ * ComponentArray sparse index benchmark
+ *
+ * Compares the paged sparse-set index against the previous
+ * std::unordered_map<EntityID, index> for lookup and add/remove throughput.
+ */
+
+namespace {
+
+// Previous ComponentArray layout, kept here only as the baseline
+template<typename T>
+class HashIndexedArray {
+private:
+    std::vector<T> m_components;
+    std::unordered_map<size_t, size_t> m_entityToIndex;
+    std::vector<size_t> m_indexToEntity;
+
+public:
+    void addComponent(size_t entityID, T component) {
+        m_entityToIndex[entityID] = m_components.size();
+        m_components.push_back(component);
+        m_indexToEntity.push_back(entityID);
+    }
+
+    void removeComponent(size_t entityID) {
+        auto it = m_entityToIndex.find(entityID);
+        if (it == m_entityToIndex.end()) return;
+        size_t indexToRemove = it->second;
+        size_t lastIndex = m_components.size() - 1;
+        if (indexToRemove != lastIndex) {
+            m_components[indexToRemove] = std::move(m_components[lastIndex]);
+            size_t entityOfLast = m_indexToEntity[lastIndex];
+            m_indexToEntity[indexToRemove] = entityOfLast;
+            m_entityToIndex[entityOfLast] = indexToRemove;
+        }
+        m_components.pop_back();
+        m_indexToEntity.pop_back();
+        m_entityToIndex.erase(entityID);
+    }
+
+    T& getComponent(size_t entityID) { return m_components[m_entityToIndex.find(entityID)->second]; }
+    bool hasComponent(size_t entityID) const { return m_entityToIndex.count(entityID) != 0; }
+};
+
+template<typename Array>
+void runCase(const char* name, size_t n, const std::vector<size_t>& lookupOrder) {
+    // Add / remove throughput: fill then drain in shuffled order
+    double addRemoveMs = Bench::bestOfMs(3, [&]() {
+        Array array;
+        for (size_t id = 0; id < n; ++id) {
+            array.addComponent(id, CTransform3D());
+        }
+        for (size_t id : lookupOrder) {
+            array.removeComponent(id);
+        }
+    });
+    Bench::printRow(std::string(name) + " add+remove", n, addRemoveMs, n * 2);
+
+    // Lookup throughput: has<T>() + get<T>() in shuffled order (as systems do)
+    Array array;
+    for (size_t id = 0; id < n; ++id) {
+        array.addComponent(id, CTransform3D());
+    }
+    double lookupMs = Bench::bestOfMs(5, [&]() {
+        float sum = 0.0f;
+        for (size_t id : lookupOrder) {
+            if (array.hasComponent(id)) {
+                sum += array.getComponent(id).position.x;
+            }
+        }
+        Bench::doNotOptimize(sum);
+    });
+    Bench::printRow(std::string(name) + " lookup", n, lookupMs, n);
+}
+
+} // namespace
+
+int main() {
+    Bench::printHeader("ComponentArray sparse index: paged sparse set vs unordered_map");
+
+    std::mt19937 rng(1234);
+    for (size_t n : {10000u, 100000u, 1000000u}) {
+        std::vector<size_t> order(n);
+        std::iota(order.begin(), order.end(), 0);
+        std::shuffle(order.begin(), order.end(), rng);
+
+        runCase<HashIndexedArray<CTransform3D>>("unordered_map", n, order);
+        runCase<ComponentArray<CTransform3D>>("paged sparse", n, order);
+    }
+    return 0;
+}
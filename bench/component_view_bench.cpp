@@ -0,0 +1,62 @@
+#include "Bench.hpp"
+#include "../include/EntityManager.h"
+#include "../include/Component.h"
+
+/**
+ * Multi-component view benchmark
+ *
+ * 100k entities all carry CTransform3D, 10% also carry CMovement3D.
+ * Compares the per-entity has<>() && has<>() loop used by systems against
+ * EntityManager::view<CTransform3D, CMovement3D>().
+ */
+
+namespace {
+
+constexpr size_t ENTITY_COUNT = 100000;
+constexpr size_t MATCH_EVERY = 10; // 10% of entities match
+constexpr float DT = 1.0f / 60.0f;
+
+void populate(EntityManager& entityManager) {
+    for (size_t i = 0; i < ENTITY_COUNT; ++i) {
+        auto e = entityManager.addEntity(EntityTag::TRIANGLE);
+        e->add<CTransform3D>(glm::vec3(static_cast<float>(i)), glm::vec3(0.0f), glm::vec3(1.0f));
+        if (i % MATCH_EVERY == 0) {
+            e->add<CMovement3D>(glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(0.0f, -1.0f, 0.0f));
+        }
+    }
+    entityManager.update();
+}
+
+} // namespace
+
+int main() {
+    EntityManager entityManager;
+    populate(entityManager);
+
+    Bench::printHeader("Transform+Movement query, 100k entities, 10% match");
+
+    double loopMs = Bench::bestOfMs(10, [&]() {
+        for (auto& entity : entityManager.getEntities()) {
+            if (!entity->has<CTransform3D>() || !entity->has<CMovement3D>()) {
+                continue;
+            }
+            auto& transform = entity->get<CTransform3D>();
+            auto& movement = entity->get<CMovement3D>();
+            movement.vel += movement.acc * DT;
+            transform.position += movement.vel * DT;
+        }
+    });
+    Bench::printRow("entity loop + has<>", ENTITY_COUNT, loopMs, ENTITY_COUNT);
+
+    double viewMs = Bench::bestOfMs(10, [&]() {
+        entityManager.view<CTransform3D, CMovement3D>().each(
+            [](size_t, CTransform3D& transform, CMovement3D& movement) {
+                movement.vel += movement.acc * DT;
+                transform.position += movement.vel * DT;
+            });
+    });
+    Bench::printRow("view<T, M>", ENTITY_COUNT, viewMs, ENTITY_COUNT);
+
+    std::printf("speedup: %.1fx\n", viewMs > 0.0 ? loopMs / viewMs : 0.0);
+    return 0;
+}
@@ -0,0 +1,102 @@
+#include "Bench.hpp"
+#include "../include/EntityManager.h"
+#include "../include/Component.h"
+#include "../include/MovementBatch.hpp"
+#include "../include/MovementSystem.hpp"
+#include <string>
+#include <vector>
+
+/**
+ * Movement integration benchmark, 1M movers
+ *
+ * - kernel: MovementBatch::integrate over resident SoA streams (the
+ *   integrator on its own, the 1M-in-2ms target)
+ * - kernel scalar: the same streams through the scalar reference
+ * - per-entity view: glm math per entity in place through a view
+ * - gather/scatter: copy 256-mover blocks into a MovementBatch, run the
+ *   kernel, write back (why MovementSystem does not do this)
+ * - MovementSystem: the full system, in place with dense speed limits
+ * Build with SIMD_CFLAGS=-mavx2 for the AVX2 kernel; default is SSE2.
+ */
+
+namespace {
+
+constexpr size_t MOVER_COUNT = 1000000;
+constexpr float DT = 1.0f / 60.0f;
+
+void populate(EntityManager& entityManager) {
+    for (size_t i = 0; i < MOVER_COUNT; ++i) {
+        float f = static_cast<float>(i % 1000);
+        auto e = entityManager.addEntity(EntityTag::TRIANGLE);
+        e->add<CTransform3D>(glm::vec3(f, 0.0f, -f), glm::vec3(0.0f), glm::vec3(1.0f));
+        e->add<CMovement3D>(glm::vec3(1.0f, 0.5f, 0.0f), glm::vec3(0.0f, -1.0f, 0.0f));
+    }
+    entityManager.update();
+}
+
+} // namespace
+
+int main() {
+    Bench::printHeader(std::string("Movement integration, 1M movers (") + MovementBatch::kernelName() + ")");
+
+    MovementBatch batch;
+    batch.reserve(MOVER_COUNT);
+    for (size_t i = 0; i < MOVER_COUNT; ++i) {
+        float f = static_cast<float>(i % 1000);
+        batch.push_back(glm::vec3(f, 0.0f, -f), glm::vec3(1.0f, 0.5f, 0.0f), glm::vec3(0.0f, -1.0f, 0.0f),
+                        (i % 4 == 0) ? 5.0f : MovementBatch::NO_SPEED_LIMIT);
+    }
+    double kernelMs = Bench::bestOfMs(20, [&]() { batch.integrate(DT, false); });
+    Bench::printRow("kernel", MOVER_COUNT, kernelMs, MOVER_COUNT);
+    double limitedMs = Bench::bestOfMs(20, [&]() { batch.integrate(DT, true); });
+    Bench::printRow("kernel + speed limit", MOVER_COUNT, limitedMs, MOVER_COUNT);
+    double scalarMs = Bench::bestOfMs(20, [&]() { batch.integrateScalar(DT, true); });
+    Bench::printRow("kernel scalar + limit", MOVER_COUNT, scalarMs, MOVER_COUNT);
+    Bench::doNotOptimize(batch.position(MOVER_COUNT - 1));
+
+    EntityManager entityManager;
+    populate(entityManager);
+
+    double viewMs = Bench::bestOfMs(10, [&]() {
+        entityManager.view<CTransform3D, CMovement3D>().each(
+            [](size_t, CTransform3D& transform, CMovement3D& movement) {
+                movement.vel += movement.acc * DT;
+                transform.position += movement.vel * DT;
+                transform.rotation += glm::vec3(0.5f) * DT;
+            });
+    });
+    Bench::printRow("per-entity view", MOVER_COUNT, viewMs, MOVER_COUNT);
+
+    MovementBatch block;
+    std::vector<CTransform3D*> transforms;
+    std::vector<CMovement3D*> movements;
+    auto flush = [&]() {
+        block.integrate(DT, false);
+        for (size_t i = 0; i < block.size(); ++i) {
+            transforms[i]->position = block.position(i);
+            transforms[i]->rotation += glm::vec3(0.5f) * DT;
+            movements[i]->vel = block.velocity(i);
+        }
+        block.clear();
+        transforms.clear();
+        movements.clear();
+    };
+    double gatherMs = Bench::bestOfMs(10, [&]() {
+        entityManager.view<CTransform3D, CMovement3D>().each(
+            [&](size_t, CTransform3D& transform, CMovement3D& movement) {
+                block.push_back(transform.position, movement.vel, movement.acc);
+                transforms.push_back(&transform);
+                movements.push_back(&movement);
+                if (block.size() == 256) {
+                    flush();
+                }
+            });
+        flush();
+    });
+    Bench::printRow("gather/scatter", MOVER_COUNT, gatherMs, MOVER_COUNT);
+
+    MovementSystem movementSystem;
+    double systemMs = Bench::bestOfMs(10, [&]() { movementSystem.updateMovement(entityManager, DT); });
+    Bench::printRow("MovementSystem", MOVER_COUNT, systemMs, MOVER_COUNT);
+    return 0;
+}
@@ -0,0 +1,73 @@
+#include "Bench.hpp"
+#include "../include/RenderQueue.hpp"
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * Render queue sort benchmark, 100k commands
+ *
+ * - radix, one state: one shader/mesh all frame, depth keys only (the
+ *   OpenGLRenderer triangle case; constant digits are skipped)
+ * - radix, mixed: 16 shaders x 64 meshes x depth
+ * - std::sort: comparison sort on the same mixed keys, for reference
+ */
+
+namespace {
+
+constexpr size_t COMMAND_COUNT = 100000;
+
+std::vector<RenderCommand> makeCommands(uint32_t shaders, uint32_t meshes) {
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> depth(0.1f, 100.0f);
+    std::uniform_int_distribution<uint32_t> shader(0, shaders - 1);
+    std::uniform_int_distribution<uint32_t> mesh(0, meshes - 1);
+    std::vector<RenderCommand> commands;
+    commands.reserve(COMMAND_COUNT);
+    for (size_t i = 0; i < COMMAND_COUNT; ++i) {
+        uint64_t key = RenderQueue::makeKey(0, shader(rng), mesh(rng), RenderQueue::depthBits(depth(rng)));
+        commands.push_back(RenderCommand{key, static_cast<uint32_t>(i)});
+    }
+    return commands;
+}
+
+double radixMs(const std::vector<RenderCommand>& commands, int& passes) {
+    RenderQueue queue;
+    queue.reserve(commands.size());
+    double ms = Bench::bestOfMs(20, [&]() {
+        queue.clear();
+        for (const RenderCommand& command : commands) {
+            queue.submit(command.key, command.index);
+        }
+        queue.sort();
+    });
+    passes = queue.getLastSortPasses();
+    Bench::doNotOptimize(queue.commands().front().index);
+    return ms;
+}
+
+} // namespace
+
+int main() {
+    Bench::printHeader("Render queue sort, 100k commands (submit + sort)");
+
+    int passes = 0;
+    double singleMs = radixMs(makeCommands(1, 1), passes);
+    Bench::printRow("radix 1 state (" + std::to_string(passes) + " passes)", COMMAND_COUNT, singleMs,
+                    COMMAND_COUNT);
+
+    std::vector<RenderCommand> mixed = makeCommands(16, 64);
+    double mixedMs = radixMs(mixed, passes);
+    Bench::printRow("radix mixed (" + std::to_string(passes) + " passes)", COMMAND_COUNT, mixedMs,
+                    COMMAND_COUNT);
+
+    std::vector<RenderCommand> work;
+    double stdMs = Bench::bestOfMs(20, [&]() {
+        work = mixed;
+        std::stable_sort(work.begin(), work.end(),
+                         [](const RenderCommand& a, const RenderCommand& b) { return a.key < b.key; });
+    });
+    Bench::printRow("std::stable_sort mixed", COMMAND_COUNT, stdMs, COMMAND_COUNT);
+    return 0;
+}
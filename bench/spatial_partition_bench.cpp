@@ -0,0 +1,171 @@
+#include "Bench.hpp"
+#include "../include/SpatialPartition.hpp"
+#include "../include/JobSystem.hpp"
+#include <random>
+#include <vector>
+
+/**
+ * Spatial partition strategy benchmark on a clustered map
+ *
+ * Entities are packed into a few dense clusters in a large, mostly empty
+ * XY world (like our generated maps). For each strategy we time a full
+ * rebuild (clear + insert), findCollisions, a frame of small moves
+ * through update(), and a full coherent frame (update + findCollisions),
+ * and report node counts from PartitionStats.
+ * (For the spatial hash, nodes are occupied cells and depth is the
+ * longest probe sequence; for sweep-and-prune, nodes are endpoints and
+ * depth is the largest set of intervals open at once; for the dynamic
+ * tree, nodes are tree nodes and depth is the root height.)
+ *
+ * A second scenario adds a handful of huge boxes (terrain chunks, trigger
+ * volumes) to the clustered map: each one covers thousands of grid/hash
+ * cells, which the tree absorbs as a single leaf.
+ *
+ * The grid's findCollisions is also timed on a JobSystem with the
+ * default worker count (hardware threads - 1).
+ */
+
+namespace {
+
+constexpr float WORLD_HALF_SIZE = 500.0f;
+constexpr float WORLD_HALF_DEPTH = 5.0f;
+constexpr float CELL_SIZE = 5.0f;
+constexpr size_t CLUSTER_COUNT = 12;
+
+std::vector<CAABB> makeClusteredBounds(size_t count, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> clusterCenter(-WORLD_HALF_SIZE * 0.9f, WORLD_HALF_SIZE * 0.9f);
+    std::normal_distribution<float> spread(0.0f, 15.0f);
+    std::uniform_real_distribution<float> depth(-WORLD_HALF_DEPTH + 1.0f, WORLD_HALF_DEPTH - 1.0f);
+    std::uniform_real_distribution<float> halfSize(0.2f, 0.8f);
+
+    std::vector<glm::vec3> clusters;
+    for (size_t c = 0; c < CLUSTER_COUNT; ++c) {
+        clusters.emplace_back(clusterCenter(rng), clusterCenter(rng), 0.0f);
+    }
+
+    std::vector<CAABB> bounds;
+    bounds.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        const glm::vec3& cluster = clusters[i % CLUSTER_COUNT];
+        glm::vec3 center(cluster.x + spread(rng), cluster.y + spread(rng), depth(rng));
+        CAABB aabb;
+        aabb.min = center - glm::vec3(halfSize(rng));
+        aabb.max = center + (center - aabb.min);
+        bounds.push_back(aabb);
+    }
+    return bounds;
+}
+
+std::vector<CAABB> addHugeBounds(std::vector<CAABB> bounds, size_t count, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> center(-WORLD_HALF_SIZE * 0.5f, WORLD_HALF_SIZE * 0.5f);
+    std::uniform_real_distribution<float> halfSize(50.0f, 150.0f);
+    for (size_t i = 0; i < count; ++i) {
+        glm::vec3 c(center(rng), center(rng), 0.0f);
+        glm::vec3 half(halfSize(rng), halfSize(rng), WORLD_HALF_DEPTH - 0.5f);
+        CAABB aabb;
+        aabb.min = c - half;
+        aabb.max = c + half;
+        bounds.push_back(aabb);
+    }
+    return bounds;
+}
+
+void run(PartitionType type, const char* label, const std::vector<CAABB>& bounds) {
+    auto partition = createSpatialPartition(type,
+                                            glm::vec3(-WORLD_HALF_SIZE, -WORLD_HALF_SIZE, -WORLD_HALF_DEPTH),
+                                            glm::vec3(WORLD_HALF_SIZE, WORLD_HALF_SIZE, WORLD_HALF_DEPTH),
+                                            CELL_SIZE);
+    size_t n = bounds.size();
+    std::string name(label);
+
+    double buildMs = Bench::bestOfMs(3, [&]() {
+        partition->clear();
+        for (size_t i = 0; i < n; ++i) {
+            partition->insert(i, bounds[i]);
+        }
+    });
+    Bench::printRow(name + " rebuild", n, buildMs, n);
+
+    size_t pairs = 0;
+    double collideMs = Bench::bestOfMs(5, [&]() {
+        pairs = partition->findCollisions().size();
+    });
+    Bench::printRow(name + " findCollisions", n, collideMs, n);
+
+    // One frame of small, coherent movement
+    std::vector<CAABB> moved = bounds;
+    float step = 0.0f;
+    double updateMs = Bench::bestOfMs(3, [&]() {
+        step += 0.05f;
+        for (size_t i = 0; i < n; ++i) {
+            glm::vec3 offset(step, -step, 0.0f);
+            moved[i].min = bounds[i].min + offset;
+            moved[i].max = bounds[i].max + offset;
+            partition->update(i, moved[i]);
+        }
+    });
+    Bench::printRow(name + " update", n, updateMs, n);
+
+    // Coherent frame: small moves, then pairs (compare with grid rebuild + findCollisions)
+    std::vector<CollisionPair> pairBuffer;
+    double frameMs = Bench::bestOfMs(5, [&]() {
+        step += 0.05f;
+        for (size_t i = 0; i < n; ++i) {
+            glm::vec3 offset(step, -step, 0.0f);
+            moved[i].min = bounds[i].min + offset;
+            moved[i].max = bounds[i].max + offset;
+            partition->update(i, moved[i]);
+        }
+        partition->findCollisions(pairBuffer);
+    });
+    Bench::printRow(name + " update+find", n, frameMs, n);
+
+    PartitionStats stats;
+    partition->getStatistics(stats);
+    std::printf("  %zu pairs, %zu nodes (%zu empty), max depth %zu, %zu checks\n",
+                pairs, stats.totalNodes, stats.emptyNodes, stats.maxDepth, stats.totalCollisionChecks);
+}
+
+void runParallelGrid(const std::vector<CAABB>& bounds) {
+    auto partition = createSpatialPartition(PartitionType::UNIFORM_GRID,
+                                            glm::vec3(-WORLD_HALF_SIZE, -WORLD_HALF_SIZE, -WORLD_HALF_DEPTH),
+                                            glm::vec3(WORLD_HALF_SIZE, WORLD_HALF_SIZE, WORLD_HALF_DEPTH),
+                                            CELL_SIZE);
+    size_t n = bounds.size();
+    for (size_t i = 0; i < n; ++i) {
+        partition->insert(i, bounds[i]);
+    }
+    
+    JobSystem jobs;
+    partition->setJobSystem(&jobs);
+    std::vector<CollisionPair> pairBuffer;
+    double collideMs = Bench::bestOfMs(5, [&]() {
+        partition->findCollisions(pairBuffer);
+    });
+    Bench::printRow("grid find x" + std::to_string(jobs.getThreadCount()) + " threads", n, collideMs, n);
+}
+
+} // namespace
+
+int main() {
+    for (size_t n : {10000, 50000}) {
+        auto bounds = makeClusteredBounds(n, 99);
+        Bench::printHeader("Clustered map, " + std::to_string(n) + " AABBs");
+        run(PartitionType::UNIFORM_GRID, "grid", bounds);
+        run(PartitionType::QUADTREE, "quadtree", bounds);
+        run(PartitionType::SPATIAL_HASH, "spatial hash", bounds);
+        run(PartitionType::SWEEP_AND_PRUNE, "sap", bounds);
+        run(PartitionType::DYNAMIC_AABB_TREE, "tree", bounds);
+        runParallelGrid(bounds);
+    }
+
+    auto mixed = addHugeBounds(makeClusteredBounds(10000, 99), 16, 7);
+    Bench::printHeader("Clustered map + 16 huge AABBs, " + std::to_string(mixed.size()) + " AABBs");
+    run(PartitionType::UNIFORM_GRID, "grid", mixed);
+    run(PartitionType::SPATIAL_HASH, "spatial hash", mixed);
+    run(PartitionType::SWEEP_AND_PRUNE, "sap", mixed);
+    run(PartitionType::DYNAMIC_AABB_TREE, "tree", mixed);
+    return 0;
+}
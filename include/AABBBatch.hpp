@@ -0,0 +1,174 @@
+#pragma once
+#include "Component.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+/**
+ * Batched AABB overlap tests over structure-of-arrays bounds
+ *
+ * AABBUtils::intersects tests one pair at a time through glm::vec3.
+ * For cell/bucket inner loops, AABBBatch stores the candidates as six
+ * float arrays and tests one box against BATCH_WIDTH of them at once,
+ * returning a bitmask (bit i set = candidate first + i overlaps).
+ *
+ * Kernel selection is compile-time:
+ * - __AVX2__: one 8-wide pass (build with -mavx2 or -march=native)
+ * - SSE2 (every x86-64 target): two 4-wide passes
+ * - otherwise: the scalar loop, same semantics
+ *
+ * Overlap is strict like AABBUtils::intersects, so touching boxes do
+ * not collide. The arrays are padded with boxes that overlap nothing,
+ * so a block may start at any index up to size() without a tail check.
+ */
+class AABBBatch {
+public:
+    static constexpr size_t BATCH_WIDTH = 8;
+
+    AABBBatch() { resizeArrays(BATCH_WIDTH); }
+
+    /**
+     * @brief Remove all boxes (keeps capacity, so refills do not allocate)
+     */
+    void clear() {
+        constexpr float inf = std::numeric_limits<float>::infinity();
+        std::fill_n(m_minX.begin(), m_size, inf);
+        std::fill_n(m_minY.begin(), m_size, inf);
+        std::fill_n(m_minZ.begin(), m_size, inf);
+        std::fill_n(m_maxX.begin(), m_size, -inf);
+        std::fill_n(m_maxY.begin(), m_size, -inf);
+        std::fill_n(m_maxZ.begin(), m_size, -inf);
+        m_size = 0;
+    }
+
+    /**
+     * @brief Append a box; its index is the previous size()
+     */
+    void push_back(const CAABB& box) {
+        resizeArrays(m_size + 1 + BATCH_WIDTH);
+        m_minX[m_size] = box.min.x;
+        m_minY[m_size] = box.min.y;
+        m_minZ[m_size] = box.min.z;
+        m_maxX[m_size] = box.max.x;
+        m_maxY[m_size] = box.max.y;
+        m_maxZ[m_size] = box.max.z;
+        m_size++;
+    }
+
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+    /**
+     * @brief Overlap mask of box against entries [first, first + BATCH_WIDTH)
+     * @param first Start of the block, at most size(); lanes past size() are never set
+     */
+    uint32_t overlapMask(const CAABB& box, size_t first) const {
+#if defined(__AVX2__)
+        return overlapMaskAVX2(box, first);
+#elif defined(__SSE2__) || defined(_M_X64)
+        return overlapMaskSSE(box, first) | (overlapMaskSSE(box, first + 4) << 4);
+#else
+        return overlapMaskScalar(box, first);
+#endif
+    }
+
+    /**
+     * @brief Index of the lowest set bit of a non-zero overlapMask() result
+     */
+    static unsigned lowestLane(uint32_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<unsigned>(__builtin_ctz(mask));
+#else
+        unsigned lane = 0;
+        while (!(mask & 1u)) {
+            mask >>= 1;
+            lane++;
+        }
+        return lane;
+#endif
+    }
+
+    /**
+     * @brief Reference implementation of overlapMask (also the non-x86 path)
+     */
+    uint32_t overlapMaskScalar(const CAABB& box, size_t first) const {
+        uint32_t mask = 0;
+        for (size_t lane = 0; lane < BATCH_WIDTH; ++lane) {
+            size_t i = first + lane;
+            bool overlap = (box.max.x > m_minX[i] && box.min.x < m_maxX[i]) &&
+                           (box.max.y > m_minY[i] && box.min.y < m_maxY[i]) &&
+                           (box.max.z > m_minZ[i] && box.min.z < m_maxZ[i]);
+            mask |= static_cast<uint32_t>(overlap) << lane;
+        }
+        return mask;
+    }
+
+    /**
+     * @brief Name of the kernel overlapMask() compiles to (for benchmarks/logs)
+     */
+    static const char* kernelName() {
+#if defined(__AVX2__)
+        return "AVX2";
+#elif defined(__SSE2__) || defined(_M_X64)
+        return "SSE2";
+#else
+        return "scalar";
+#endif
+    }
+
+private:
+    // Padding boxes are inverted (min = +inf, max = -inf) and overlap nothing
+    void resizeArrays(size_t count) {
+        if (m_minX.size() >= count) {
+            return;
+        }
+        constexpr float inf = std::numeric_limits<float>::infinity();
+        m_minX.resize(count, inf);
+        m_minY.resize(count, inf);
+        m_minZ.resize(count, inf);
+        m_maxX.resize(count, -inf);
+        m_maxY.resize(count, -inf);
+        m_maxZ.resize(count, -inf);
+    }
+
+#if defined(__AVX2__)
+    uint32_t overlapMaskAVX2(const CAABB& box, size_t first) const {
+        __m256 overlap = _mm256_and_ps(
+            _mm256_cmp_ps(_mm256_set1_ps(box.max.x), _mm256_loadu_ps(&m_minX[first]), _CMP_GT_OQ),
+            _mm256_cmp_ps(_mm256_set1_ps(box.min.x), _mm256_loadu_ps(&m_maxX[first]), _CMP_LT_OQ));
+        overlap = _mm256_and_ps(overlap,
+            _mm256_cmp_ps(_mm256_set1_ps(box.max.y), _mm256_loadu_ps(&m_minY[first]), _CMP_GT_OQ));
+        overlap = _mm256_and_ps(overlap,
+            _mm256_cmp_ps(_mm256_set1_ps(box.min.y), _mm256_loadu_ps(&m_maxY[first]), _CMP_LT_OQ));
+        overlap = _mm256_and_ps(overlap,
+            _mm256_cmp_ps(_mm256_set1_ps(box.max.z), _mm256_loadu_ps(&m_minZ[first]), _CMP_GT_OQ));
+        overlap = _mm256_and_ps(overlap,
+            _mm256_cmp_ps(_mm256_set1_ps(box.min.z), _mm256_loadu_ps(&m_maxZ[first]), _CMP_LT_OQ));
+        return static_cast<uint32_t>(_mm256_movemask_ps(overlap));
+    }
+#elif defined(__SSE2__) || defined(_M_X64)
+    uint32_t overlapMaskSSE(const CAABB& box, size_t first) const {
+        __m128 overlap = _mm_and_ps(
+            _mm_cmpgt_ps(_mm_set1_ps(box.max.x), _mm_loadu_ps(&m_minX[first])),
+            _mm_cmplt_ps(_mm_set1_ps(box.min.x), _mm_loadu_ps(&m_maxX[first])));
+        overlap = _mm_and_ps(overlap, _mm_cmpgt_ps(_mm_set1_ps(box.max.y), _mm_loadu_ps(&m_minY[first])));
+        overlap = _mm_and_ps(overlap, _mm_cmplt_ps(_mm_set1_ps(box.min.y), _mm_loadu_ps(&m_maxY[first])));
+        overlap = _mm_and_ps(overlap, _mm_cmpgt_ps(_mm_set1_ps(box.max.z), _mm_loadu_ps(&m_minZ[first])));
+        overlap = _mm_and_ps(overlap, _mm_cmplt_ps(_mm_set1_ps(box.min.z), _mm_loadu_ps(&m_maxZ[first])));
+        return static_cast<uint32_t>(_mm_movemask_ps(overlap));
+    }
+#endif
+
+    // Each array holds size() boxes plus at least BATCH_WIDTH padding boxes
+    std::vector<float> m_minX, m_minY, m_minZ;
+    std::vector<float> m_maxX, m_maxY, m_maxZ;
+    size_t m_size = 0;
+};
@@ -0,0 +1,436 @@
+#pragma once
+
+#include "ComponentTypes.hpp"
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * Archetype (chunked SoA) Component Storage
+ *
+ * Alternative backend for ComponentManager (ComponentStorageMode::ARCHETYPE):
+ * - Entities with the same component mask share an archetype
+ * - Each archetype stores rows in fixed-size chunks (ARCHETYPE_CHUNK_BYTES)
+ * - Inside a chunk: one entity ID column plus one column per component type
+ * - Rows are kept packed (swap-remove), so every chunk but the last is full
+ *
+ * Multi-component iteration walks matching archetypes chunk by chunk and is
+ * purely linear. The trade-off is that adding/removing a component moves the
+ * entity's whole row to another archetype, and any reference previously
+ * returned for that entity's components is invalidated.
+ */
+
+// Bytes per archetype chunk (entity IDs + all component columns)
+constexpr size_t ARCHETYPE_CHUNK_BYTES = 16 * 1024;
+
+/**
+ * Type-erased operations needed to relocate components between chunks
+ */
+struct ComponentTypeInfo {
+    size_t size = 0;
+    size_t alignment = 0;
+    void (*moveConstruct)(void* dst, void* src) = nullptr;
+    void (*destroy)(void* ptr) = nullptr;
+    const char* name = nullptr;
+
+    template<typename T>
+    static ComponentTypeInfo of() {
+        ComponentTypeInfo info;
+        info.size = sizeof(T);
+        info.alignment = alignof(T);
+        info.moveConstruct = [](void* dst, void* src) {
+            new (dst) T(std::move(*static_cast<T*>(src)));
+        };
+        info.destroy = [](void* ptr) {
+            static_cast<T*>(ptr)->~T();
+        };
+        info.name = typeid(T).name();
+        return info;
+    }
+};
+
+class ArchetypeStorage {
+private:
+    static constexpr uint32_t INVALID_ARCHETYPE = UINT32_MAX;
+
+    /**
+     * Fixed-size block of rows for one archetype
+     * Layout: [entity IDs x capacity][column 0 x capacity][column 1 x capacity]...
+     */
+    struct Chunk {
+        std::unique_ptr<std::byte[]> data;
+    };
+
+    struct Archetype {
+        ComponentMask mask;
+        std::vector<size_t> componentIDs;                // Ascending type IDs, one per column
+        std::array<int, MAX_COMPONENTS> columnOf;        // Type ID -> column, -1 if absent
+        std::vector<size_t> columnOffsets;               // Byte offset of each column in a chunk
+        size_t capacity = 0;                             // Rows per chunk
+        size_t chunkBytes = 0;
+        size_t size = 0;                                 // Rows in use across all chunks
+        std::vector<Chunk> chunks;
+
+        // Cached transitions when adding/removing one component type
+        std::array<uint32_t, MAX_COMPONENTS> addEdges;
+        std::array<uint32_t, MAX_COMPONENTS> removeEdges;
+    };
+
+    struct EntityLocation {
+        uint32_t archetype = INVALID_ARCHETYPE;
+        size_t row = 0;
+    };
+
+    std::array<ComponentTypeInfo, MAX_COMPONENTS> m_typeInfos;
+    std::vector<std::unique_ptr<Archetype>> m_archetypes;
+    std::unordered_map<ComponentMask, uint32_t> m_archetypeByMask;
+    std::vector<EntityLocation> m_locations; // Indexed by entity ID
+
+    static size_t alignUp(size_t value, size_t alignment) {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    /**
+     * Get storage for (column, row) of an archetype
+     */
+    void* componentPtr(Archetype& archetype, size_t column, size_t row) {
+        const ComponentTypeInfo& info = m_typeInfos[archetype.componentIDs[column]];
+        std::byte* base = archetype.chunks[row / archetype.capacity].data.get();
+        return base + archetype.columnOffsets[column] + (row % archetype.capacity) * info.size;
+    }
+
+    size_t& entityAt(Archetype& archetype, size_t row) {
+        std::byte* base = archetype.chunks[row / archetype.capacity].data.get();
+        return reinterpret_cast<size_t*>(base)[row % archetype.capacity];
+    }
+
+    uint32_t createArchetype(const ComponentMask& mask) {
+        auto archetype = std::make_unique<Archetype>();
+        archetype->mask = mask;
+        archetype->columnOf.fill(-1);
+        archetype->addEdges.fill(INVALID_ARCHETYPE);
+        archetype->removeEdges.fill(INVALID_ARCHETYPE);
+
+        size_t rowBytes = sizeof(size_t);
+        for (size_t id = 0; id < MAX_COMPONENTS; ++id) {
+            if (mask[id]) {
+                assert(m_typeInfos[id].size > 0 && "Component type not registered with archetype storage");
+                assert(m_typeInfos[id].alignment <= alignof(std::max_align_t) && "Over-aligned component type");
+                archetype->columnOf[id] = static_cast<int>(archetype->componentIDs.size());
+                archetype->componentIDs.push_back(id);
+                rowBytes += m_typeInfos[id].size;
+            }
+        }
+
+        // Fit as many rows as possible into one chunk, accounting for column alignment padding.
+        // A single row larger than a chunk gets an oversized chunk of capacity 1.
+        size_t capacity = std::max<size_t>(1, ARCHETYPE_CHUNK_BYTES / rowBytes);
+        while (true) {
+            archetype->columnOffsets.clear();
+            size_t offset = capacity * sizeof(size_t);
+            for (size_t id : archetype->componentIDs) {
+                offset = alignUp(offset, m_typeInfos[id].alignment);
+                archetype->columnOffsets.push_back(offset);
+                offset += capacity * m_typeInfos[id].size;
+            }
+            if (offset <= ARCHETYPE_CHUNK_BYTES || capacity == 1) {
+                archetype->capacity = capacity;
+                archetype->chunkBytes = std::max(offset, ARCHETYPE_CHUNK_BYTES);
+                break;
+            }
+            capacity--;
+        }
+
+        uint32_t index = static_cast<uint32_t>(m_archetypes.size());
+        m_archetypes.push_back(std::move(archetype));
+        m_archetypeByMask[mask] = index;
+        return index;
+    }
+
+    uint32_t findOrCreateArchetype(const ComponentMask& mask) {
+        auto it = m_archetypeByMask.find(mask);
+        if (it != m_archetypeByMask.end()) {
+            return it->second;
+        }
+        return createArchetype(mask);
+    }
+
+    /**
+     * Get archetype reached by adding (add=true) or removing a component type
+     */
+    uint32_t transition(uint32_t from, size_t componentID, bool add) {
+        if (from == INVALID_ARCHETYPE) {
+            ComponentMask mask;
+            mask.set(componentID);
+            return findOrCreateArchetype(mask);
+        }
+
+        // Archetypes are heap-allocated, so edges stays valid if m_archetypes grows
+        auto& edges = add ? m_archetypes[from]->addEdges : m_archetypes[from]->removeEdges;
+        if (edges[componentID] == INVALID_ARCHETYPE) {
+            ComponentMask mask = m_archetypes[from]->mask;
+            mask.set(componentID, add);
+            edges[componentID] = findOrCreateArchetype(mask);
+        }
+        return edges[componentID];
+    }
+
+    size_t allocateRow(Archetype& archetype, size_t entityID) {
+        if (archetype.size == archetype.chunks.size() * archetype.capacity) {
+            Chunk chunk;
+            chunk.data = std::make_unique<std::byte[]>(archetype.chunkBytes);
+            archetype.chunks.push_back(std::move(chunk));
+        }
+        size_t row = archetype.size++;
+        entityAt(archetype, row) = entityID;
+        return row;
+    }
+
+    /**
+     * Destroy a row and fill the hole with the archetype's last row
+     */
+    void removeRow(Archetype& archetype, size_t row) {
+        size_t columnCount = archetype.componentIDs.size();
+        for (size_t c = 0; c < columnCount; ++c) {
+            m_typeInfos[archetype.componentIDs[c]].destroy(componentPtr(archetype, c, row));
+        }
+
+        size_t last = archetype.size - 1;
+        if (row != last) {
+            for (size_t c = 0; c < columnCount; ++c) {
+                const ComponentTypeInfo& info = m_typeInfos[archetype.componentIDs[c]];
+                void* lastPtr = componentPtr(archetype, c, last);
+                info.moveConstruct(componentPtr(archetype, c, row), lastPtr);
+                info.destroy(lastPtr);
+            }
+            size_t movedEntity = entityAt(archetype, last);
+            entityAt(archetype, row) = movedEntity;
+            m_locations[movedEntity].row = row;
+        }
+
+        archetype.size--;
+        // Release the trailing chunk once it is empty
+        if (archetype.size == (archetype.chunks.size() - 1) * archetype.capacity) {
+            archetype.chunks.pop_back();
+        }
+    }
+
+    /**
+     * Move entity's row to another archetype, carrying over shared components
+     * Columns only present in the destination are left unconstructed for the caller
+     */
+    void moveEntity(size_t entityID, uint32_t to) {
+        EntityLocation& location = m_locations[entityID];
+        Archetype& dst = *m_archetypes[to];
+        size_t dstRow = allocateRow(dst, entityID);
+
+        if (location.archetype != INVALID_ARCHETYPE) {
+            Archetype& src = *m_archetypes[location.archetype];
+            for (size_t c = 0; c < dst.componentIDs.size(); ++c) {
+                size_t id = dst.componentIDs[c];
+                int srcColumn = src.columnOf[id];
+                if (srcColumn >= 0) {
+                    m_typeInfos[id].moveConstruct(componentPtr(dst, c, dstRow),
+                                                  componentPtr(src, srcColumn, location.row));
+                }
+            }
+            removeRow(src, location.row);
+        }
+
+        location.archetype = to;
+        location.row = dstRow;
+    }
+
+    template<typename Fn, typename... Components, size_t... Is>
+    void eachInChunk(Fn& fn, Archetype& archetype, size_t chunkIndex,
+                     std::index_sequence<Is...>) {
+        std::byte* base = archetype.chunks[chunkIndex].data.get();
+        size_t rows = std::min(archetype.capacity, archetype.size - chunkIndex * archetype.capacity);
+
+        const size_t* entityIDs = reinterpret_cast<const size_t*>(base);
+        std::tuple<Components*...> columns(reinterpret_cast<Components*>(
+            base + archetype.columnOffsets[archetype.columnOf[ComponentTypeIDGenerator::getID<Components>()]])...);
+
+        for (size_t i = 0; i < rows; ++i) {
+            fn(entityIDs[i], std::get<Is>(columns)[i]...);
+        }
+    }
+
+public:
+    ArchetypeStorage() = default;
+    ~ArchetypeStorage() { clear(); }
+
+    ArchetypeStorage(const ArchetypeStorage&) = delete;
+    ArchetypeStorage& operator=(const ArchetypeStorage&) = delete;
+
+    /**
+     * Register type-erased operations for a component type
+     * Must be called before the type is added to any entity
+     */
+    void registerType(size_t componentID, const ComponentTypeInfo& info) {
+        assert(componentID < MAX_COMPONENTS && "Too many component types");
+        m_typeInfos[componentID] = info;
+    }
+
+    /**
+     * Check if entity has component type
+     */
+    bool hasComponent(size_t entityID, size_t componentID) const {
+        if (entityID >= m_locations.size() || m_locations[entityID].archetype == INVALID_ARCHETYPE) {
+            return false;
+        }
+        return m_archetypes[m_locations[entityID].archetype]->mask[componentID];
+    }
+
+    /**
+     * Get component for entity
+     * @return Pointer to component, or nullptr if entity doesn't have it
+     */
+    template<typename T>
+    T* get(size_t entityID) {
+        if (entityID >= m_locations.size() || m_locations[entityID].archetype == INVALID_ARCHETYPE) {
+            return nullptr;
+        }
+        const EntityLocation& location = m_locations[entityID];
+        Archetype& archetype = *m_archetypes[location.archetype];
+        int column = archetype.columnOf[ComponentTypeIDGenerator::getID<T>()];
+        if (column < 0) {
+            return nullptr;
+        }
+        return static_cast<T*>(componentPtr(archetype, column, location.row));
+    }
+
+    template<typename T>
+    const T* get(size_t entityID) const {
+        return const_cast<ArchetypeStorage*>(this)->get<T>(entityID);
+    }
+
+    /**
+     * Add component to entity, moving it to the matching archetype
+     * @return Reference to stored component (valid until entity's next structural change)
+     */
+    template<typename T>
+    T& add(size_t entityID, T&& component) {
+        size_t componentID = ComponentTypeIDGenerator::getID<T>();
+        assert(entityID != INVALID_ENTITY_ID && "Invalid entity ID");
+        assert(!hasComponent(entityID, componentID) && "Component already exists for entity");
+
+        if (entityID >= m_locations.size()) {
+            m_locations.resize(entityID + 1);
+        }
+
+        uint32_t to = transition(m_locations[entityID].archetype, componentID, true);
+        moveEntity(entityID, to);
+
+        const EntityLocation& location = m_locations[entityID];
+        Archetype& archetype = *m_archetypes[to];
+        void* slot = componentPtr(archetype, archetype.columnOf[componentID], location.row);
+        return *new (slot) T(std::move(component));
+    }
+
+    /**
+     * Remove one component type from entity
+     */
+    void remove(size_t entityID, size_t componentID) {
+        if (!hasComponent(entityID, componentID)) {
+            return;
+        }
+
+        EntityLocation& location = m_locations[entityID];
+        if (m_archetypes[location.archetype]->mask.count() == 1) {
+            removeAll(entityID);
+            return;
+        }
+
+        uint32_t to = transition(location.archetype, componentID, false);
+        moveEntity(entityID, to);
+    }
+
+    /**
+     * Remove all components from entity
+     */
+    void removeAll(size_t entityID) {
+        if (entityID >= m_locations.size() || m_locations[entityID].archetype == INVALID_ARCHETYPE) {
+            return;
+        }
+        EntityLocation& location = m_locations[entityID];
+        removeRow(*m_archetypes[location.archetype], location.row);
+        location.archetype = INVALID_ARCHETYPE;
+    }
+
+    /**
+     * Destroy all components and archetypes (type registrations are kept)
+     */
+    void clear() {
+        for (auto& archetype : m_archetypes) {
+            for (size_t row = 0; row < archetype->size; ++row) {
+                for (size_t c = 0; c < archetype->componentIDs.size(); ++c) {
+                    m_typeInfos[archetype->componentIDs[c]].destroy(componentPtr(*archetype, c, row));
+                }
+            }
+        }
+        m_archetypes.clear();
+        m_archetypeByMask.clear();
+        m_locations.clear();
+    }
+
+    /**
+     * Invoke fn(entityID, Components&...) for every entity having all Components
+     * Walks matching archetypes chunk by chunk; rows within a chunk are contiguous.
+     * Structural changes inside fn invalidate the iteration.
+     */
+    template<typename... Components, typename Fn>
+    void each(Fn&& fn) {
+        ComponentMask required;
+        (required.set(ComponentTypeIDGenerator::getID<Components>()), ...);
+
+        for (auto& archetype : m_archetypes) {
+            if (archetype->size == 0 || (archetype->mask & required) != required) {
+                continue;
+            }
+            for (size_t c = 0; c < archetype->chunks.size(); ++c) {
+                eachInChunk<Fn, Components...>(fn, *archetype, c, std::index_sequence_for<Components...>{});
+            }
+        }
+    }
+
+    /**
+     * Count entities that have all of the given component type IDs
+     */
+    size_t countMatching(const ComponentMask& required) const {
+        size_t count = 0;
+        for (const auto& archetype : m_archetypes) {
+            if ((archetype->mask & required) == required) {
+                count += archetype->size;
+            }
+        }
+        return count;
+    }
+
+    /**
+     * Count components of one type across all archetypes
+     */
+    size_t count(size_t componentID) const {
+        ComponentMask required;
+        required.set(componentID);
+        return countMatching(required);
+    }
+
+    size_t getArchetypeCount() const { return m_archetypes.size(); }
+
+    size_t getChunkCount() const {
+        size_t chunks = 0;
+        for (const auto& archetype : m_archetypes) {
+            chunks += archetype->chunks.size();
+        }
+        return chunks;
+    }
+};
@@ -13,5 +13,7 @@ public:
   virtual void sMovement(float deltaTime) = 0;
   virtual void sInput(sf::Event &event, float deltaTime) = 0;
   virtual void sRender() = 0;
+  // Fraction of a fixed tick the next sRender() sits past the last sMovement()
+  virtual void setRenderInterpolation(float /*alpha*/) {};
   virtual bool isPaused() const { return false; };
 };
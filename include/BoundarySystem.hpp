@@ -2,6 +2,7 @@
 
 #include "Component.h"
 #include "EntityManager.h"
+#include "JobSystem.hpp"
 #include <glm/glm.hpp>
 #include <memory>
 
@@ -32,8 +33,20 @@ public:
     BoundarySystem(const BoundaryConstraint& constraint);
     ~BoundarySystem() = default;
 
+    /**
+     * @brief Apply the boundary action to every entity outside the bounds
+     *
+     * With a job system the bounds test runs data-parallel and the
+     * violations are handled afterwards on the calling thread, sorted by
+     * entity ID so the result does not depend on thread timing.
+     */
     void enforceBoundaries(EntityManager& entityManager);
     
+    /**
+     * @brief Run the bounds test across jobs (nullptr = calling thread only)
+     */
+    void setJobSystem(JobSystem* jobs) { m_jobs = jobs; }
+    
     void setBoundaryConstraint(const BoundaryConstraint& constraint);
     
     void setEntityBoundaryAction(EntityTag tag, BoundaryAction action, float damping = 0.9f);
@@ -43,6 +56,8 @@ public:
     glm::vec3 getViolatedBoundaries(std::shared_ptr<Entity> entity) const;
 
 private:
+    bool isPositionOutOfBounds(const glm::vec3& position) const;
+    
     void handleBoundaryViolation(std::shared_ptr<Entity> entity, const glm::vec3& violations);
     
     void applyBounceAction(std::shared_ptr<Entity> entity, const glm::vec3& violations, float damping);
@@ -55,6 +70,10 @@ private:
     
     float getDampingForEntity(std::shared_ptr<Entity> entity) const;
     
+    JobSystem* m_jobs = nullptr;
+    std::vector<std::vector<size_t>> m_threadViolations; // Out-of-bounds IDs found by each job thread
+    std::vector<size_t> m_violations;
+    
     BoundaryConstraint m_globalConstraint;
     std::unordered_map<EntityTag, BoundaryAction> m_entityActions;
     std::unordered_map<EntityTag, float> m_entityDamping;
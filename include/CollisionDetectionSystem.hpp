@@ -2,6 +2,9 @@
 
 #include "Component.h"
 #include "EntityManager.h"
+#include "SpatialPartition.hpp"
+#include "PartitionSync.hpp"
+#include "Constants.hpp"
 #include <vector>
 #include <memory>
 #include <glm/glm.hpp>
@@ -17,21 +20,73 @@ struct CollisionEvent {
         : entityA(a), entityB(b), contactPoint(0.0f), contactNormal(0.0f), penetrationDepth(0.0f) {}
 };
 
+/**
+ * CollisionDetectionSystem - Produces CollisionEvents for CollisionResolutionSystem
+ *
+ * Broadphase runs through a SpatialPartitionStrategy kept up to date
+ * incrementally by a PartitionSync: entities are registered when the
+ * EntityManager adds them, dropped when it removes them, and only
+ * entities whose world AABB changed are updated each frame. Candidate
+ * pairs come from findCollisions(), and only those pairs get contact
+ * details. Entities entirely outside the partition's world bounds are
+ * not tested.
+ */
 class CollisionDetectionSystem {
+private:
+    std::unique_ptr<SpatialPartitionStrategy> m_broadphase;
+    std::shared_ptr<PartitionSync> m_sync; // Bound to the last manager passed in
+    std::vector<CollisionPair> m_pairs;    // Broadphase output, reused across frames
+
 public:
-    CollisionDetectionSystem() = default;
+    /**
+     * @brief Create detection system with the given broadphase strategy
+     * @param type Spatial partitioning algorithm used for the broadphase
+     * @param worldMin Minimum world bounds covered by the broadphase
+     * @param worldMax Maximum world bounds covered by the broadphase
+     * @param cellSize Grid cell size (for uniform grid)
+     */
+    explicit CollisionDetectionSystem(
+        PartitionType type = PartitionType::UNIFORM_GRID,
+        const glm::vec3& worldMin = glm::vec3(EngineConstants::SpatialPartition::DEFAULT_WORLD_MIN),
+        const glm::vec3& worldMax = glm::vec3(EngineConstants::SpatialPartition::DEFAULT_WORLD_MAX),
+        float cellSize = EngineConstants::SpatialPartition::DEFAULT_CELL_SIZE);
     ~CollisionDetectionSystem() = default;
 
+    /**
+     * @brief Find all colliding entity pairs this frame
+     * @param entityManager Entity manager owning the entities
+     * @return One event per colliding pair, ordered by (entityA id, entityB id)
+     */
     std::vector<CollisionEvent> detectCollisions(EntityManager& entityManager);
     
+    /**
+     * @brief Broadphase structure used by detectCollisions (for queries and statistics)
+     */
+    const SpatialPartitionStrategy& getBroadphase() const { return *m_broadphase; }
+    
+    /**
+     * @brief Broadphase registration state (nullptr before the first detectCollisions)
+     */
+    const PartitionSync* getPartitionSync() const { return m_sync.get(); }
+    
+    /**
+     * @brief Run broadphase pair generation on a worker pool
+     * @param jobs Pool shared with other systems (must outlive this system), or nullptr
+     * 
+     * Events are produced in the same order either way.
+     */
+    void setJobSystem(JobSystem* jobs) { m_broadphase->setJobSystem(jobs); }
+    
     bool checkAABBCollision(const CAABB& a, const CAABB& b);
     
-    CollisionEvent calculateCollisionDetails(std::shared_ptr<Entity> entityA, std::shared_ptr<Entity> entityB);
+    CollisionEvent calculateCollisionDetails(const std::shared_ptr<Entity>& entityA, const std::shared_ptr<Entity>& entityB);
     
-    void updateAABBForEntity(std::shared_ptr<Entity> entity);
+    void updateAABBForEntity(const std::shared_ptr<Entity>& entity);
 
 private:
-    CAABB getWorldAABB(std::shared_ptr<Entity> entity);
+    static void updateAABB(const CTransform3D& transform, CAABB& aabb);
+    
+    CAABB getWorldAABB(const std::shared_ptr<Entity>& entity);
     
     glm::vec3 calculateContactPoint(const CAABB& a, const CAABB& b);
     glm::vec3 calculateContactNormal(const CAABB& a, const CAABB& b);
@@ -2,6 +2,7 @@
 
 #include "SpatialPartition.hpp"
 #include "EntityManager.h"
+#include "PartitionSync.hpp"
 #include <memory>
 #include <vector>
 
@@ -16,6 +17,7 @@
 class CollisionSystem {
 private:
     std::unique_ptr<SpatialPartitionStrategy> m_spatialPartition;
+    std::shared_ptr<PartitionSync> m_sync; // Incremental registration, bound to one EntityManager
     glm::vec3 m_worldMin;
     glm::vec3 m_worldMax;
     
@@ -39,7 +41,9 @@ public:
      * @brief Update collision system with all entities that have CAABB and CTransform3D
      * @param entityManager Entity manager containing entities to check for collisions
      * 
-     * Rebuilds spatial partitioning structure with current entity positions and bounds.
+     * Brings the spatial partition up to date incrementally: entities added or
+     * removed by EntityManager::update() are registered/unregistered, and only
+     * entities whose world AABB changed since the last call are updated.
      * Must be called once per frame before collision detection to ensure accuracy.
      * Only processes entities that have both CAABB and CTransform3D components.
      */
@@ -55,6 +59,13 @@ public:
      */
     std::vector<CollisionPair> findCollisions();
     
+    /**
+     * @brief Find all collision pairs into a caller-owned buffer
+     * @param out Replaced with the colliding pairs; reuse it across frames
+     *            so the broadphase does not allocate once warmed up
+     */
+    void findCollisions(std::vector<CollisionPair>& out);
+    
     /**
      * Find entities colliding with a specific entity
      * @param entity Target entity to check collisions against
@@ -92,6 +103,12 @@ public:
      */
     PartitionStats getStatistics() const;
     
+    /**
+     * Registration work done by the last updateEntities() call
+     * (nullptr before the first call or after clear())
+     */
+    const PartitionSync* getPartitionSync() const { return m_sync.get(); }
+    
     /**
      * Clear all entities from the collision system
      * Should be called when changing scenes
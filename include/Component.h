@@ -3,6 +3,7 @@
 #include <SFML/Graphics.hpp>
 #include <SFML/Graphics/CircleShape.hpp>
 #include <SFML/System/Vector2.hpp>
+#include <glm/ext/matrix_float4x4.hpp>
 #include <glm/ext/vector_float3.hpp>
 
 typedef sf::Vector2f Vec2f;
@@ -27,11 +28,20 @@ public:
   glm::vec3 position = {0.0f, 0.0f, 0.0f};
   glm::vec3 rotation = {0.0f, 0.0f, 0.0f};
   glm::vec3 scale = {1.0f, 1.0f, 1.0f};
+  // Set by whatever writes the transform; cleared when CModelMatrix is rebuilt
+  bool dirty = true;
   CTransform3D();
   CTransform3D(const glm::vec3 &position, const glm::vec3 &rotation,
                const glm::vec3 &scale);
 };
 
+// Cached translate * rotate * scale of the entity's CTransform3D (see TransformSystem)
+class CModelMatrix : public Component {
+public:
+  glm::mat4 matrix = glm::mat4(1.0f);
+  CModelMatrix();
+};
+
 class CShape : public Component {
 public:
   sf::CircleShape circle;
@@ -212,6 +222,15 @@ public:
   float outlineThickness;
   bool showVertices = false;      // Debug mode
   
+  // Triangle lists for ShapeBatch, and the vertices/thickness they were built from
+  std::vector<Vec2f> fillTriangles;
+  std::vector<Vec2f> outlineTriangles;
+  std::vector<Vec2f> triangulatedVertices;
+  float triangulatedThickness = 0.0f;
+  
   CComplexShape();
   CComplexShape(const std::vector<Vec2f>& verts, sf::Color fill, sf::Color outline, float thickness);
+  
+  // Re-triangulate if vertices or outlineThickness changed; true if rebuilt
+  bool updateTriangulation();
 };
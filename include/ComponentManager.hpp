@@ -1,12 +1,20 @@
 #pragma once
 
+#include "ComponentTypes.hpp"
+#include "ArchetypeStorage.hpp"
+#include "JobSystem.hpp"
 #include <vector>
 #include <unordered_map>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <bitset>
 #include <cassert>
 #include <typeinfo>
 #include <typeindex>
+#include <tuple>
+#include <utility>
 
 /**
  * Array-Based ECS Component Management System
@@ -19,38 +27,32 @@
  * - Compatible: Same API as tuple-based system
  */
 
-// Maximum number of component types supported
-constexpr size_t MAX_COMPONENTS = 64;
+// Entity IDs covered by one page of a component array's sparse index
+// Must be a power of two so page/offset split is a shift and a mask
+constexpr size_t SPARSE_PAGE_SIZE = 4096;
+static_assert((SPARSE_PAGE_SIZE & (SPARSE_PAGE_SIZE - 1)) == 0,
+              "SPARSE_PAGE_SIZE must be a power of two");
 
-// Invalid component/entity constants
-constexpr size_t INVALID_COMPONENT_ID = SIZE_MAX;
-constexpr size_t INVALID_ENTITY_ID = SIZE_MAX;
+// Entities per job in ComponentView::parallelEach (smaller views run inline)
+constexpr size_t PARALLEL_EACH_GRAIN = 1024;
 
 /**
- * Component Type ID Generator
- * Assigns unique IDs to component types at compile time
+ * Component storage backend used by a ComponentManager
+ * - SPARSE_SET: one dense ComponentArray per type (cheap add/remove, stable per-type arrays)
+ * - ARCHETYPE: chunked SoA rows grouped by component mask (linear multi-component views)
  */
-class ComponentTypeIDGenerator {
-private:
-    static size_t s_nextID;
-    
-public:
-    /**
-     * @brief Get unique type ID for component type T (thread-safe)
-     * @return Unique ID for component type T, same ID returned for same type
-     * 
-     * Uses static local variable to ensure each component type gets exactly one ID.
-     * First call for a type increments the global counter.
-     */
-    template<typename T>
-    static size_t getID() {
-        static size_t id = s_nextID++;
-        return id;
-    }
-    
-    static size_t getNextID() { return s_nextID; }
+enum class ComponentStorageMode {
+    SPARSE_SET,
+    ARCHETYPE
 };
 
+// Build with -DECS_ARCHETYPE_STORAGE to make archetype storage the default backend
+#ifdef ECS_ARCHETYPE_STORAGE
+constexpr ComponentStorageMode DEFAULT_COMPONENT_STORAGE_MODE = ComponentStorageMode::ARCHETYPE;
+#else
+constexpr ComponentStorageMode DEFAULT_COMPONENT_STORAGE_MODE = ComponentStorageMode::SPARSE_SET;
+#endif
+
 /**
  * Base class for component storage arrays
  * Provides polymorphic interface for component management
@@ -91,38 +93,76 @@ public:
 /**
  * Type-specific dense component array
  * Stores components contiguously for cache efficiency
+ *
+ * Entity -> dense index lookups go through a paged sparse array:
+ * - Entity ID splits into (page, offset) with a shift and a mask
+ * - Pages of SPARSE_PAGE_SIZE slots are allocated on first use
+ * - Unused slots hold INVALID_ENTITY_ID
+ * A lookup is two dependent loads instead of a hash probe, and memory
+ * only grows with the ID ranges actually in use.
  */
 template<typename T>
 class ComponentArray : public IComponentArray {
 private:
+    using SparsePage = std::unique_ptr<size_t[]>;
+    
     // Dense array of components (contiguous storage)
     std::vector<T> m_components;
     
-    // Sparse array: EntityID -> Index in dense array
-    std::unordered_map<size_t, size_t> m_entityToIndex;
+    // Sparse array: EntityID -> Index in dense array (paged, lazily allocated)
+    std::vector<SparsePage> m_sparsePages;
     
     // Dense array: Index -> EntityID (for reverse lookup)
     std::vector<size_t> m_indexToEntity;
     
+    static constexpr size_t pageOf(size_t entityID) { return entityID / SPARSE_PAGE_SIZE; }
+    static constexpr size_t offsetOf(size_t entityID) { return entityID & (SPARSE_PAGE_SIZE - 1); }
+    
+    /**
+     * Get sparse slot for entity, allocating its page if needed
+     */
+    size_t& sparseSlot(size_t entityID) {
+        size_t page = pageOf(entityID);
+        if (page >= m_sparsePages.size()) {
+            m_sparsePages.resize(page + 1);
+        }
+        if (!m_sparsePages[page]) {
+            m_sparsePages[page] = std::make_unique<size_t[]>(SPARSE_PAGE_SIZE);
+            std::fill_n(m_sparsePages[page].get(), SPARSE_PAGE_SIZE, INVALID_ENTITY_ID);
+        }
+        return m_sparsePages[page][offsetOf(entityID)];
+    }
+    
 public:
     ComponentArray() = default;
     
+    /**
+     * Get dense index of entity's component
+     * @param entityID Entity to look up
+     * @return Index into getData(), or INVALID_ENTITY_ID if entity has no component
+     */
+    size_t indexOf(size_t entityID) const {
+        size_t page = pageOf(entityID);
+        if (page >= m_sparsePages.size() || !m_sparsePages[page]) {
+            return INVALID_ENTITY_ID;
+        }
+        return m_sparsePages[page][offsetOf(entityID)];
+    }
+    
     /**
      * Add component for entity
      * @param entityID Entity to add component to
      * @param component Component data to add
      */
     void addComponent(size_t entityID, T component) {
-        assert(m_entityToIndex.find(entityID) == m_entityToIndex.end() && 
-               "Component already exists for entity");
+        assert(entityID != INVALID_ENTITY_ID && "Invalid entity ID");
+        size_t& slot = sparseSlot(entityID);
+        assert(slot == INVALID_ENTITY_ID && "Component already exists for entity");
         
         // Add to dense arrays
-        size_t newIndex = m_components.size();
-        m_components.push_back(component);
+        slot = m_components.size();
+        m_components.push_back(std::move(component));
         m_indexToEntity.push_back(entityID);
-        
-        // Update sparse mapping
-        m_entityToIndex[entityID] = newIndex;
     }
     
     /**
@@ -130,12 +170,11 @@ public:
      * Uses swap-and-pop for O(1) removal
      */
     void removeComponent(size_t entityID) override {
-        auto it = m_entityToIndex.find(entityID);
-        if (it == m_entityToIndex.end()) {
+        size_t indexToRemove = indexOf(entityID);
+        if (indexToRemove == INVALID_ENTITY_ID) {
             return; // Component doesn't exist
         }
         
-        size_t indexToRemove = it->second;
         size_t lastIndex = m_components.size() - 1;
         
         // Swap with last element (if not already last)
@@ -146,13 +185,13 @@ public:
             // Update entity mapping for swapped component
             size_t entityOfLastComponent = m_indexToEntity[lastIndex];
             m_indexToEntity[indexToRemove] = entityOfLastComponent;
-            m_entityToIndex[entityOfLastComponent] = indexToRemove;
+            m_sparsePages[pageOf(entityOfLastComponent)][offsetOf(entityOfLastComponent)] = indexToRemove;
         }
         
         // Remove last element
         m_components.pop_back();
         m_indexToEntity.pop_back();
-        m_entityToIndex.erase(entityID);
+        m_sparsePages[pageOf(entityID)][offsetOf(entityID)] = INVALID_ENTITY_ID;
     }
     
     /**
@@ -161,22 +200,22 @@ public:
      * @return Reference to component
      */
     T& getComponent(size_t entityID) {
-        auto it = m_entityToIndex.find(entityID);
-        assert(it != m_entityToIndex.end() && "Component does not exist for entity");
-        return m_components[it->second];
+        size_t index = indexOf(entityID);
+        assert(index != INVALID_ENTITY_ID && "Component does not exist for entity");
+        return m_components[index];
     }
     
     const T& getComponent(size_t entityID) const {
-        auto it = m_entityToIndex.find(entityID);
-        assert(it != m_entityToIndex.end() && "Component does not exist for entity");
-        return m_components[it->second];
+        size_t index = indexOf(entityID);
+        assert(index != INVALID_ENTITY_ID && "Component does not exist for entity");
+        return m_components[index];
     }
     
     /**
      * Check if entity has component
      */
     bool hasComponent(size_t entityID) const override {
-        return m_entityToIndex.find(entityID) != m_entityToIndex.end();
+        return indexOf(entityID) != INVALID_ENTITY_ID;
     }
     
     /**
@@ -188,11 +227,25 @@ public:
     
     /**
      * Clear all components
+     * Sparse pages are released too so a cleared array holds no index memory
      */
     void clear() override {
         m_components.clear();
         m_indexToEntity.clear();
-        m_entityToIndex.clear();
+        m_sparsePages.clear();
+    }
+    
+    /**
+     * Get number of allocated sparse index pages (for memory profiling)
+     */
+    size_t getSparsePageCount() const {
+        size_t count = 0;
+        for (const auto& page : m_sparsePages) {
+            if (page) {
+                count++;
+            }
+        }
+        return count;
     }
     
     /**
@@ -230,9 +283,134 @@ public:
     const std::vector<size_t>& getEntityIDs() const { return m_indexToEntity; }
 };
 
+/**
+ * Multi-component view over several ComponentArrays
+ * 
+ * Iterates every entity that has all of Components...:
+ * - Driven by the dense entity list of the smallest array
+ * - Remaining arrays are probed through their sparse index (O(1) each)
+ * - Callback receives component references directly, no Entity lookup
+ * 
+ * Usage:
+ *   manager.view<CTransform3D, CMovement3D>().each(
+ *       [](size_t id, CTransform3D& t, CMovement3D& m) { ... });
+ * 
+ * Adding or removing components of the viewed types inside the callback
+ * invalidates the iteration; defer structural changes until after each().
+ * 
+ * In ComponentStorageMode::ARCHETYPE the view instead walks every archetype
+ * containing all Components, chunk by chunk.
+ */
+template<typename... Components>
+class ComponentView {
+    static_assert(sizeof...(Components) > 0, "ComponentView requires at least one component type");
+    
+private:
+    std::tuple<ComponentArray<Components>*...> m_arrays;
+    
+    // Entity list of the smallest array (drives iteration)
+    const std::vector<size_t>* m_driverEntities = nullptr;
+    
+    // Set when viewing archetype storage instead of component arrays
+    ArchetypeStorage* m_archetypes = nullptr;
+    
+    // Visit driver entities [begin, end); returns how many matched
+    template<typename Fn, size_t... Is>
+    size_t eachImpl(Fn& fn, size_t begin, size_t end, std::index_sequence<Is...>) {
+        size_t indices[sizeof...(Components)];
+        size_t visited = 0;
+        
+        for (size_t i = begin; i < end; ++i) {
+            size_t entityID = (*m_driverEntities)[i];
+            // Short-circuits on the first array missing the entity
+            bool matches = (((indices[Is] = std::get<Is>(m_arrays)->indexOf(entityID)) != INVALID_ENTITY_ID) && ...);
+            if (!matches) {
+                continue;
+            }
+            fn(entityID, std::get<Is>(m_arrays)->getData()[indices[Is]]...);
+            visited++;
+        }
+        return visited;
+    }
+    
+public:
+    explicit ComponentView(ComponentArray<Components>*... arrays) : m_arrays(arrays...) {
+        size_t smallest = SIZE_MAX;
+        auto considerDriver = [&](const auto* array) {
+            if (array->size() < smallest) {
+                smallest = array->size();
+                m_driverEntities = &array->getEntityIDs();
+            }
+        };
+        (considerDriver(arrays), ...);
+    }
+    
+    explicit ComponentView(ArchetypeStorage* archetypes) : m_archetypes(archetypes) {}
+    
+    /**
+     * @brief Invoke fn(entityID, Components&...) for every matching entity
+     * @param fn Callable taking the entity ID followed by one reference per component type
+     */
+    template<typename Fn>
+    void each(Fn&& fn) {
+        if (m_archetypes) {
+            m_archetypes->each<Components...>(fn);
+            return;
+        }
+        eachImpl(fn, 0, m_driverEntities->size(), std::index_sequence_for<Components...>{});
+    }
+    
+    /**
+     * @brief each() split across a JobSystem by dense ranges of the driving array
+     * @param jobs Pool to run on; the calling thread takes part
+     * @param fn Same signature as for each(); called concurrently for different
+     *        entities, so it may only write to the components it is given (or
+     *        to per-thread state via jobs.getCurrentThreadIndex())
+     * @param grain Entities per job; views this small or smaller run inline
+     * @return Number of entities fn was called for
+     * 
+     * Archetype storage runs serially through each().
+     */
+    template<typename Fn>
+    size_t parallelEach(JobSystem& jobs, Fn&& fn, size_t grain = PARALLEL_EACH_GRAIN) {
+        if (m_archetypes) {
+            size_t visited = 0;
+            m_archetypes->each<Components...>([&](size_t entityID, Components&... components) {
+                fn(entityID, components...);
+                visited++;
+            });
+            return visited;
+        }
+        
+        std::atomic<size_t> visited{0};
+        jobs.parallelForRange(m_driverEntities->size(), grain, [&](size_t begin, size_t end, size_t) {
+            visited.fetch_add(eachImpl(fn, begin, end, std::index_sequence_for<Components...>{}),
+                              std::memory_order_relaxed);
+        });
+        return visited.load();
+    }
+    
+    /**
+     * @brief Upper bound on matching entities (size of the driving array)
+     * Exact count in archetype mode.
+     */
+    size_t sizeHint() const {
+        if (m_archetypes) {
+            ComponentMask required;
+            (required.set(ComponentTypeIDGenerator::getID<Components>()), ...);
+            return m_archetypes->countMatching(required);
+        }
+        return m_driverEntities->size();
+    }
+};
+
 /**
  * Component Manager - Central registry for all component types
  * Manages component arrays and provides unified access interface
+ * 
+ * Storage backend is chosen at construction (see ComponentStorageMode).
+ * In ARCHETYPE mode adding or removing a component relocates the entity's
+ * row, invalidating references previously returned for that entity.
  */
 class ComponentManager {
 private:
@@ -245,13 +423,33 @@ private:
     // Component names for debugging
     std::vector<std::string> m_componentNames;
     
+    // Chunked archetype storage (ARCHETYPE mode only)
+    std::unique_ptr<ArchetypeStorage> m_archetypes;
+    
 public:
-    ComponentManager() {
+    explicit ComponentManager(ComponentStorageMode mode = DEFAULT_COMPONENT_STORAGE_MODE) {
         // Reserve space for maximum components
         m_componentArrays.resize(MAX_COMPONENTS);
         m_componentNames.resize(MAX_COMPONENTS);
+        
+        if (mode == ComponentStorageMode::ARCHETYPE) {
+            m_archetypes = std::make_unique<ArchetypeStorage>();
+        }
     }
     
+    /**
+     * Get storage backend in use
+     */
+    ComponentStorageMode getStorageMode() const {
+        return m_archetypes ? ComponentStorageMode::ARCHETYPE : ComponentStorageMode::SPARSE_SET;
+    }
+    
+    /**
+     * Get archetype storage (nullptr in SPARSE_SET mode)
+     */
+    ArchetypeStorage* getArchetypeStorage() { return m_archetypes.get(); }
+    const ArchetypeStorage* getArchetypeStorage() const { return m_archetypes.get(); }
+    
     /**
      * Register component type (called automatically on first use)
      */
@@ -268,6 +466,10 @@ public:
         m_componentArrays[componentID] = std::make_unique<ComponentArray<T>>();
         m_typeToComponentID[typeIndex] = componentID;
         m_componentNames[componentID] = typeid(T).name();
+        
+        if (m_archetypes) {
+            m_archetypes->registerType(componentID, ComponentTypeInfo::of<T>());
+        }
     }
     
     /**
@@ -287,6 +489,7 @@ public:
     
     /**
      * Get component array for type T
+     * Sparse-set storage only: in ARCHETYPE mode the array exists but stays empty
      */
     template<typename T>
     ComponentArray<T>* getComponentArray() {
@@ -334,16 +537,39 @@ public:
         T component(std::forward<Args>(args)...);
         component.exists = true; // Maintain compatibility with existing Component base class
         
-        componentArray->addComponent(entityID, component);
+        if (m_archetypes) {
+            return m_archetypes->add<T>(entityID, std::move(component));
+        }
+        
+        componentArray->addComponent(entityID, std::move(component));
         return componentArray->getComponent(entityID);
     }
     
+    /**
+     * @brief Create a view over all entities that have every type in Components
+     * @return View iterating the smallest of the requested component arrays
+     * 
+     * Automatically registers component types that have not been used yet.
+     */
+    template<typename... Components>
+    ComponentView<Components...> view() {
+        if (m_archetypes) {
+            (getComponentTypeID<Components>(), ...);
+            return ComponentView<Components...>(m_archetypes.get());
+        }
+        return ComponentView<Components...>(getComponentArray<Components>()...);
+    }
+    
     /**
      * Remove component from entity
      */
     template<typename T>
     void removeComponent(size_t entityID) {
         ComponentArray<T>* componentArray = getComponentArray<T>();
+        if (m_archetypes) {
+            m_archetypes->remove(entityID, ComponentTypeIDGenerator::getID<T>());
+            return;
+        }
         componentArray->removeComponent(entityID);
     }
     
@@ -353,12 +579,22 @@ public:
     template<typename T>
     T& getComponent(size_t entityID) {
         ComponentArray<T>* componentArray = getComponentArray<T>();
+        if (m_archetypes) {
+            T* component = m_archetypes->get<T>(entityID);
+            assert(component && "Component does not exist for entity");
+            return *component;
+        }
         return componentArray->getComponent(entityID);
     }
     
     template<typename T>
     const T& getComponent(size_t entityID) const {
         const ComponentArray<T>* componentArray = getComponentArray<T>();
+        if (m_archetypes) {
+            const T* component = m_archetypes->get<T>(entityID);
+            assert(component && "Component does not exist for entity");
+            return *component;
+        }
         return componentArray->getComponent(entityID);
     }
     
@@ -371,6 +607,9 @@ public:
         if (componentID >= m_componentArrays.size() || !m_componentArrays[componentID]) {
             return false;
         }
+        if (m_archetypes) {
+            return m_archetypes->hasComponent(entityID, componentID);
+        }
         return m_componentArrays[componentID]->hasComponent(entityID);
     }
     
@@ -382,6 +621,10 @@ public:
      * Safe to call even if entity has no components of certain types.
      */
     void removeAllComponents(size_t entityID) {
+        if (m_archetypes) {
+            m_archetypes->removeAll(entityID);
+            return;
+        }
         for (auto& componentArray : m_componentArrays) {
             if (componentArray) {
                 componentArray->removeComponent(entityID);
@@ -398,6 +641,9 @@ public:
                 componentArray->clear();
             }
         }
+        if (m_archetypes) {
+            m_archetypes->clear();
+        }
     }
     
     /**
@@ -407,6 +653,8 @@ public:
         size_t totalComponentTypes = 0;
         size_t totalComponents = 0;
         std::vector<std::pair<std::string, size_t>> componentCounts;
+        size_t archetypeCount = 0;  // ARCHETYPE mode only
+        size_t chunkCount = 0;      // ARCHETYPE mode only
     };
     
     /**
@@ -421,7 +669,7 @@ public:
         for (size_t i = 0; i < m_componentArrays.size(); ++i) {
             if (m_componentArrays[i]) {
                 stats.totalComponentTypes++;
-                size_t count = m_componentArrays[i]->size();
+                size_t count = m_archetypes ? m_archetypes->count(i) : m_componentArrays[i]->size();
                 stats.totalComponents += count;
                 
                 if (count > 0) {
@@ -430,6 +678,11 @@ public:
             }
         }
         
+        if (m_archetypes) {
+            stats.archetypeCount = m_archetypes->getArchetypeCount();
+            stats.chunkCount = m_archetypes->getChunkCount();
+        }
+        
         return stats;
     }
 };
\ No newline at end of file
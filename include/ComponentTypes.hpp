@@ -0,0 +1,47 @@
+#pragma once
+
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Shared ECS component type definitions
+ * 
+ * Type IDs, limits and masks used by every component storage backend
+ * (sparse-set ComponentArray and ArchetypeStorage).
+ */
+
+// Maximum number of component types supported
+constexpr size_t MAX_COMPONENTS = 64;
+
+// Invalid component/entity constants
+constexpr size_t INVALID_COMPONENT_ID = SIZE_MAX;
+constexpr size_t INVALID_ENTITY_ID = SIZE_MAX;
+
+// One bit per component type ID
+using ComponentMask = std::bitset<MAX_COMPONENTS>;
+
+/**
+ * Component Type ID Generator
+ * Assigns unique IDs to component types at compile time
+ */
+class ComponentTypeIDGenerator {
+private:
+    static size_t s_nextID;
+    
+public:
+    /**
+     * @brief Get unique type ID for component type T (thread-safe)
+     * @return Unique ID for component type T, same ID returned for same type
+     * 
+     * Uses static local variable to ensure each component type gets exactly one ID.
+     * First call for a type increments the global counter.
+     */
+    template<typename T>
+    static size_t getID() {
+        static size_t id = s_nextID++;
+        return id;
+    }
+    
+    static size_t getNextID() { return s_nextID; }
+};
@@ -39,6 +39,11 @@ constexpr float CLEAR_COLOR_A = 1.0f;
 constexpr int TRIANGLE_VERTEX_DATA_SIZE = 18; // 6 components × 3 vertices
 constexpr int VERTEX_STRIDE_SIZE = 6;         // position(3) + color(3)
 constexpr int COLOR_ATTRIBUTE_OFFSET = 3;     // Offset for color data in vertex
+constexpr unsigned int INSTANCE_MODEL_ATTRIBUTE = 2; // First of 4 locations for the per-instance mat4
+constexpr unsigned int CAMERA_UBO_BINDING = 0;       // Uniform buffer binding of the Camera block
+
+// Debug lines: CGridLine::width is in world-ish units, GL wants pixels
+constexpr float LINE_WIDTH_PIXELS_PER_UNIT = 100.0f;
 } // namespace Graphics
 
 // ============================================================================
@@ -78,6 +83,10 @@ namespace World {
 constexpr float MIN_BOUND = -10.0f;
 constexpr float MAX_BOUND = 10.0f;
 
+// Broadphase cell edge for the scene's triangles (AABB half-extent 0.5),
+// so each cell holds a handful of entities instead of the whole world
+constexpr float BROADPHASE_CELL_SIZE = 2.0f;
+
 // Collision response
 constexpr float COLLISION_DAMPING_FACTOR = -0.95f;
 
@@ -104,13 +113,35 @@ constexpr int MIN_ENTITIES_FOR_COLLISION =
     2; // Skip collision check if < 2 entities
 constexpr int QUADTREE_MAX_ENTITIES_PER_NODE =
     8; // Max entities before subdivision
+constexpr int QUADTREE_MAX_DEPTH = 10; // Hard cap on subdivision levels
+constexpr float QUADTREE_LOOSENESS =
+    2.0f; // Loose node bounds = looseness * tight half-size
 constexpr float SPATIAL_HASH_DEFAULT_CELL_SIZE = 10.0f;
+constexpr int SPATIAL_HASH_INITIAL_CAPACITY =
+    1024; // Key table slots, must be a power of two
+constexpr float DYNAMIC_TREE_FAT_MARGIN =
+    0.1f; // World units added around each leaf AABB
+constexpr float DYNAMIC_TREE_DISPLACEMENT_MULTIPLIER =
+    2.0f; // Leaf bounds extend this many frames of motion ahead
+constexpr int PARALLEL_MIN_ENTITIES =
+    2048; // Smaller partitions find pairs on the calling thread only
+constexpr int PARALLEL_CHUNKS_PER_THREAD =
+    4; // Work chunks per job-system thread, for load balancing
 
 // Geometric calculations
 constexpr float CENTER_CALCULATION_FACTOR = 0.5f; // For computing AABB centers
 constexpr float HALF_EXTENTS_FACTOR = 0.5f;       // For computing half-extents
 } // namespace SpatialPartition
 
+// ============================================================================
+// Job System
+// ============================================================================
+
+namespace Jobs {
+constexpr int INITIAL_QUEUE_CAPACITY =
+    256; // Jobs per thread deque before it grows (growth allocates)
+} // namespace Jobs
+
 // ============================================================================
 // User Interface and Input
 // ============================================================================
@@ -174,6 +205,11 @@ namespace Physics {
 // Gravity acceleration
 constexpr float GRAVITY_X = 0.0f;
 constexpr float GRAVITY_Y = 9.8f; // Standard Earth gravity (m/s²)
+
+// Fixed timestep (see FixedTimestep)
+constexpr float TICK_RATE = 120.0f; // Simulation ticks per second
+constexpr int MAX_SUBSTEPS =
+    8; // Catch-up ticks per frame; older backlog is dropped
 } // namespace Physics
 
 } // namespace EngineConstants
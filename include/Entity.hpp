@@ -1,6 +1,7 @@
 #pragma once
 #include "Component.h"
 #include "ComponentManager.hpp"
+#include "EntityHandle.hpp"
 #include <bitset>
 #include <memory>
 
@@ -26,6 +27,7 @@ class Entity {
 private:
     // Entity identification
     size_t m_id = 0;
+    uint32_t m_generation = 0;
     EntityTag m_tag = EntityTag::DEFAULT;
     bool m_active = true;
     
@@ -36,17 +38,19 @@ private:
     static std::unique_ptr<ComponentManager> s_componentManager;
     
     // Private constructor for EntityManager
-    Entity(const size_t &id, const EntityTag &tag) : m_id(id), m_tag(tag) {}
+    Entity(const size_t &id, const EntityTag &tag, uint32_t generation = 0)
+        : m_id(id), m_generation(generation), m_tag(tag) {}
     
     friend class EntityManager;
     
 public:
     /**
      * Initialize component manager (called once at startup)
+     * @param mode Storage backend; ignored if a manager already exists
      */
-    static void initializeComponentManager() {
+    static void initializeComponentManager(ComponentStorageMode mode = DEFAULT_COMPONENT_STORAGE_MODE) {
         if (!s_componentManager) {
-            s_componentManager = std::make_unique<ComponentManager>();
+            s_componentManager = std::make_unique<ComponentManager>(mode);
         }
     }
     
@@ -69,6 +73,7 @@ public:
     // ========================================================================
     
     size_t id() const;
+    EntityHandle handle() const;
     bool isActive() const;
     void destroy();
     const EntityTag &tag() const;
@@ -212,9 +217,13 @@ public:
     
     /**
      * Destructor - clean up components when entity is destroyed
+     * 
+     * Skipped when the mask is already empty: EntityManager strips components
+     * when it frees the slot, and the ID may since have been reused by a
+     * newer entity whose components must not be touched.
      */
     ~Entity() {
-        if (s_componentManager) {
+        if (s_componentManager && m_componentMask.any()) {
             removeAllComponents();
         }
     }
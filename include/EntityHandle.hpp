@@ -0,0 +1,62 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+
+/**
+ * Generational Entity Handle
+ *
+ * Lightweight 32+32-bit reference to an entity owned by EntityManager:
+ * - index: slot in the EntityManager slot table (same value as Entity::id())
+ * - generation: incremented every time the slot is freed
+ *
+ * Slots are recycled through a free list, so an index alone is not enough
+ * to identify an entity. A handle only resolves while its generation
+ * matches the slot's, which makes stale handles detectable instead of
+ * silently aliasing whichever entity reused the slot.
+ *
+ * Handles are trivially copyable - passing or storing them never touches
+ * a shared_ptr refcount.
+ */
+struct EntityHandle {
+    static constexpr uint32_t INVALID_INDEX = UINT32_MAX;
+
+    uint32_t index = INVALID_INDEX;
+    uint32_t generation = 0;
+
+    constexpr EntityHandle() = default;
+    constexpr EntityHandle(uint32_t idx, uint32_t gen) : index(idx), generation(gen) {}
+
+    /**
+     * Check if handle was never assigned (does not check liveness)
+     */
+    constexpr bool isNull() const { return index == INVALID_INDEX; }
+
+    /**
+     * Pack into a single 64-bit value (generation in the high bits)
+     */
+    constexpr uint64_t toBits() const {
+        return (static_cast<uint64_t>(generation) << 32) | index;
+    }
+
+    static constexpr EntityHandle fromBits(uint64_t bits) {
+        return EntityHandle(static_cast<uint32_t>(bits & 0xFFFFFFFFu),
+                            static_cast<uint32_t>(bits >> 32));
+    }
+
+    constexpr bool operator==(const EntityHandle& other) const {
+        return index == other.index && generation == other.generation;
+    }
+
+    constexpr bool operator!=(const EntityHandle& other) const {
+        return !(*this == other);
+    }
+};
+
+namespace std {
+template<>
+struct hash<EntityHandle> {
+    size_t operator()(const EntityHandle& handle) const {
+        return std::hash<uint64_t>{}(handle.toBits());
+    }
+};
+}
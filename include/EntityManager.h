@@ -1,5 +1,7 @@
 #pragma once
 #include "Entity.hpp"
+#include "EntityHandle.hpp"
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
@@ -10,17 +12,60 @@ typedef std::map<EntityTag, EntityVec> EntityMap;
 
 // template <typename T> bool has() const { return has_impl<T>(std::make_) }
 
+/**
+ * Receives entity lifecycle events from EntityManager::update()
+ * Lets systems keep derived structures (e.g. spatial partitions) in sync
+ * incrementally instead of rebuilding them from getEntities() every frame.
+ */
+class EntityListener {
+public:
+  virtual ~EntityListener() = default;
+
+  /**
+   * @brief Entity moved from pending into the active collections
+   */
+  virtual void onEntityAdded(Entity &entity) = 0;
+
+  /**
+   * @brief Entity is being removed; its components are still readable
+   */
+  virtual void onEntityRemoved(Entity &entity) = 0;
+};
+
 class EntityManager {
 private:
+  /**
+   * Slot table entry - one per entity ID ever handed out
+   * A slot is free when entity is null; its index is then on m_freeSlots
+   */
+  struct EntitySlot {
+    std::shared_ptr<Entity> entity;
+    uint32_t generation = 0;
+    bool added = false; // moved from m_toAdd into m_entities by update()
+  };
+
   EntityVec m_entities;
   EntityMap m_entityMap;
   EntityVec m_toAdd;
-  size_t m_totalEntities = 0;
+
+  // Generational slot table (indexed by entity ID) with free list for reuse
+  std::vector<EntitySlot> m_slots;
+  std::vector<uint32_t> m_freeSlots;
+
+  // Handles of m_entities, same order (for refcount-free iteration)
+  std::vector<EntityHandle> m_handles;
+
+  // Lifecycle listeners, held weakly so they may die before the manager
+  std::vector<std::weak_ptr<EntityListener>> m_listeners;
+
+  template <typename Fn> void notifyListeners(Fn &&fn);
+
+  void releaseSlot(size_t id);
 
 public:
-  EntityManager() {
+  explicit EntityManager(ComponentStorageMode storageMode = DEFAULT_COMPONENT_STORAGE_MODE) {
     // Initialize component system
-    Entity::initializeComponentManager();
+    Entity::initializeComponentManager(storageMode);
   }
   
   ~EntityManager() {
@@ -41,6 +86,8 @@ public:
    * @return Shared pointer to the newly created entity
    * 
    * Entity is not immediately added to active collections - call update() to process.
+   * The entity's ID is a recycled slot index; use entity->handle() to keep a
+   * reference that can detect the entity's destruction.
    */
   std::shared_ptr<Entity> addEntity(const EntityTag &tag);
   
@@ -56,6 +103,44 @@ public:
    */
   std::shared_ptr<Entity> getEntityById(size_t id);
   std::shared_ptr<Entity> getEntityById(size_t id) const;
+
+  /**
+   * @brief Get handles of all entities, in the same order as getEntities()
+   * @return Handles of active entities
+   *
+   * Lets systems iterate without copying shared_ptrs or touching refcounts.
+   */
+  const std::vector<EntityHandle> &getHandles() const;
+
+  /**
+   * @brief Resolve a handle to its entity
+   * @param handle Handle obtained from Entity::handle() or getHandles()
+   * @return Non-owning pointer to entity, or nullptr if handle is stale
+   *
+   * O(1) slot lookup. Pending (not yet updated) entities resolve too.
+   */
+  Entity *getEntity(const EntityHandle &handle);
+  const Entity *getEntity(const EntityHandle &handle) const;
+
+  /**
+   * @brief Check if a handle still refers to a live entity
+   * @param handle Handle to check
+   * @return False once the entity has been destroyed and removed by update()
+   */
+  bool isValid(const EntityHandle &handle) const;
+
+  /**
+   * @brief View over entities that have all of the given components
+   * @return ComponentView yielding (entityID, Components&...) per match
+   *
+   * Preferred over walking getEntities() with has<>() checks: iteration is
+   * driven by the smallest component array and never touches Entity objects.
+   * Entities still pending addition are included if they already have the
+   * components.
+   */
+  template <typename... Components> ComponentView<Components...> view() {
+    return Entity::getComponentManager()->view<Components...>();
+  }
   
   /**
    * @brief Check if any entities exist with the specified tag
@@ -63,11 +148,25 @@ public:
    * @return True if at least one entity has this tag
    */
   bool hasTag(const EntityTag &tag) const;
+
+  /**
+   * @brief Subscribe to entity added/removed events
+   * @param listener Listener to notify; held weakly, dropped once expired
+   *
+   * Events fire from update() (and clear() for removals), in entity order.
+   */
+  void addListener(const std::shared_ptr<EntityListener> &listener);
+
+  /**
+   * @brief Check if listener is currently subscribed to this manager
+   */
+  bool hasListener(const EntityListener *listener) const;
   
   /**
    * @brief Remove all entities and reset the manager to initial state
    * 
    * Clears all active entities, pending additions, and component data.
+   * Outstanding handles become stale; IDs restart from 0.
    */
   void clear();
 };
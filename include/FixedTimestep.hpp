@@ -0,0 +1,94 @@
+#pragma once
+#include "Constants.hpp"
+#include <cassert>
+#include <cmath>
+
+/**
+ * FixedTimestep - Accumulator that turns variable frame times into fixed ticks
+ *
+ * Each frame, advance() adds the frame's wall time and returns how many
+ * simulation ticks of getStep() seconds to run. The remainder carries
+ * over, and getAlpha() says how far the render frame sits between the
+ * last two ticks (0 = previous tick, 1 = latest), for interpolation.
+ *
+ * At most maxSubsteps ticks run per frame. When the simulation falls
+ * further behind (a slow frame, a debugger pause), the older backlog is
+ * dropped so the game slows down instead of spiralling.
+ *
+ * Usage:
+ *   int ticks = timestep.advance(frameSeconds);
+ *   for (int i = 0; i < ticks; ++i) scene->sMovement(timestep.getStep());
+ *   scene->setRenderInterpolation(timestep.getAlpha());
+ */
+class FixedTimestep {
+public:
+    explicit FixedTimestep(float tickRate = EngineConstants::Physics::TICK_RATE,
+                           int maxSubsteps = EngineConstants::Physics::MAX_SUBSTEPS)
+        : m_maxSubsteps(maxSubsteps) {
+        setTickRate(tickRate);
+        assert(maxSubsteps > 0 && "FixedTimestep needs at least one substep per frame");
+    }
+
+    /**
+     * @brief Change the simulation rate; the accumulated time is kept
+     */
+    void setTickRate(float tickRate) {
+        assert(tickRate > 0.0f && "Tick rate must be positive");
+        m_step = 1.0f / tickRate;
+    }
+
+    void setMaxSubsteps(int maxSubsteps) {
+        assert(maxSubsteps > 0 && "FixedTimestep needs at least one substep per frame");
+        m_maxSubsteps = maxSubsteps;
+    }
+
+    /**
+     * @brief Add a frame's wall time and return the number of ticks to run now
+     */
+    int advance(float frameSeconds) {
+        if (frameSeconds > 0.0f) {
+            m_accumulator += frameSeconds;
+        }
+        int ticks = 0;
+        while (m_accumulator >= m_step && ticks < m_maxSubsteps) {
+            m_accumulator -= m_step;
+            ticks++;
+        }
+        if (m_accumulator >= m_step) {
+            // Capped: keep only the fraction of a tick, drop the backlog
+            float remainder = std::fmod(m_accumulator, m_step);
+            m_droppedSeconds += m_accumulator - remainder;
+            m_accumulator = remainder;
+        }
+        m_totalTicks += ticks;
+        return ticks;
+    }
+
+    /**
+     * @brief Discard accumulated time (e.g. while paused, so unpausing does not burst)
+     */
+    void reset() { m_accumulator = 0.0f; }
+
+    float getStep() const { return m_step; }
+    float getTickRate() const { return 1.0f / m_step; }
+    int getMaxSubsteps() const { return m_maxSubsteps; }
+
+    /**
+     * @brief Fraction of a tick accumulated since the last tick, in [0, 1)
+     */
+    float getAlpha() const { return m_accumulator / m_step; }
+
+    long long getTotalTicks() const { return m_totalTicks; }
+
+    /**
+     * @brief Simulation time skipped because of the substep cap
+     */
+    double getDroppedSeconds() const { return m_droppedSeconds; }
+
+private:
+    float m_step = 0.0f;
+    float m_accumulator = 0.0f;
+    int m_maxSubsteps;
+    long long m_totalTicks = 0;
+    double m_droppedSeconds = 0.0;
+};
@@ -0,0 +1,101 @@
+#pragma once
+#include "Component.h"
+#include <array>
+#include <cmath>
+#include <glm/glm.hpp>
+
+/**
+ * Frustum - Six world-space planes of a camera's view volume
+ *
+ * Planes are extracted from projection * view (Gribb/Hartmann) and
+ * normalized, with normals pointing inward, so a point p is inside a
+ * plane when dot(normal, p) + d >= 0. Tests are conservative: they may
+ * keep a volume just outside a corner, but never reject a visible one.
+ *
+ * Usage:
+ *   Frustum frustum(camera->getProjectionMatrix(aspect) * camera->getViewMatrix());
+ *   partition.query(frustum.bounds(), candidates);
+ *   if (frustum.intersectsSphere(center, radius)) { ... }
+ */
+class Frustum {
+public:
+    enum Plane { LEFT_PLANE, RIGHT_PLANE, BOTTOM_PLANE, TOP_PLANE, NEAR_PLANE, FAR_PLANE, PLANE_COUNT };
+
+    explicit Frustum(const glm::mat4& viewProjection) {
+        // glm is column-major: row i is (m[0][i], m[1][i], m[2][i], m[3][i])
+        auto row = [&](int i) {
+            return glm::vec4(viewProjection[0][i], viewProjection[1][i], viewProjection[2][i],
+                             viewProjection[3][i]);
+        };
+        const glm::vec4 x = row(0), y = row(1), z = row(2), w = row(3);
+        m_planes[LEFT_PLANE] = w + x;
+        m_planes[RIGHT_PLANE] = w - x;
+        m_planes[BOTTOM_PLANE] = w + y;
+        m_planes[TOP_PLANE] = w - y;
+        m_planes[NEAR_PLANE] = w + z;
+        m_planes[FAR_PLANE] = w - z;
+        for (auto& plane : m_planes) {
+            float length = glm::length(glm::vec3(plane.x, plane.y, plane.z));
+            plane = plane * (1.0f / length);
+        }
+    }
+
+    const glm::vec4& plane(Plane which) const { return m_planes[which]; }
+
+    bool containsPoint(const glm::vec3& point) const { return intersectsSphere(point, 0.0f); }
+
+    bool intersectsSphere(const glm::vec3& center, float radius) const {
+        for (const auto& plane : m_planes) {
+            if (plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w < -radius) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief False only if the box is entirely behind one plane
+     */
+    bool intersectsAABB(const CAABB& box) const {
+        for (const auto& plane : m_planes) {
+            // Corner furthest along the plane normal
+            glm::vec3 positive(plane.x >= 0.0f ? box.max.x : box.min.x,
+                               plane.y >= 0.0f ? box.max.y : box.min.y,
+                               plane.z >= 0.0f ? box.max.z : box.min.z);
+            if (plane.x * positive.x + plane.y * positive.y + plane.z * positive.z + plane.w < 0.0f) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief World-space box around the eight frustum corners
+     */
+    CAABB bounds() const {
+        CAABB box;
+        box.min = glm::vec3(INFINITY);
+        box.max = glm::vec3(-INFINITY);
+        for (Plane depth : {NEAR_PLANE, FAR_PLANE}) {
+            for (Plane side : {LEFT_PLANE, RIGHT_PLANE}) {
+                for (Plane vertical : {BOTTOM_PLANE, TOP_PLANE}) {
+                    glm::vec3 corner = intersection(m_planes[depth], m_planes[side], m_planes[vertical]);
+                    box.min = glm::min(box.min, corner);
+                    box.max = glm::max(box.max, corner);
+                }
+            }
+        }
+        return box;
+    }
+
+private:
+    std::array<glm::vec4, PLANE_COUNT> m_planes;
+
+    // Point on all three planes n.p + d = 0
+    static glm::vec3 intersection(const glm::vec4& a, const glm::vec4& b, const glm::vec4& c) {
+        glm::vec3 na(a.x, a.y, a.z), nb(b.x, b.y, b.z), nc(c.x, c.y, c.z);
+        glm::vec3 bc = glm::cross(nb, nc);
+        float denominator = glm::dot(na, bc);
+        return (bc * -a.w + glm::cross(nc, na) * -b.w + glm::cross(na, nb) * -c.w) * (1.0f / denominator);
+    }
+};
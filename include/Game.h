@@ -4,7 +4,9 @@
 #include "../include/MapScene.h"
 #include "../include/VoronoiMapScene.h"
 #include "Component.h"
+#include "FixedTimestep.hpp"
 #include "InputEvent.hpp"
+#include "JobSystem.hpp"
 #include "Renderer.h"
 #include "SceneManager.hpp"
 #include <SFML/Graphics.hpp>
@@ -17,9 +19,11 @@ class Game {
 private:
   Config m_config;
   bool m_running = true;
+  JobSystem m_jobSystem; // Declared before the scenes so it outlives them
   SceneManager m_sceneManager;
   int m_currentFrame = 0;
   sf::Clock m_deltaClock;
+  FixedTimestep m_timestep; // Simulation ticks at Physics::TICK_RATE, decoupled from rendering
   sf::Font m_font;
   sf::RenderWindow m_window;
   sf::Text m_text;
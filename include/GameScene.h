@@ -5,11 +5,15 @@
 #include "Entity.hpp"
 #include "InputController.hpp"
 #include "OpenGLRenderer.hpp"
-#include "CollisionSystem.hpp"
+#include "NullRenderer.hpp"
 #include "CollisionDetectionSystem.hpp"
 #include "CollisionResolutionSystem.hpp"
 #include "BoundarySystem.hpp"
 #include "MovementSystem.hpp"
+#include "TransformSystem.hpp"
+#include "JobSystem.hpp"
+#include "LineBatch.hpp"
+#include "SystemScheduler.hpp"
 #include <cstddef>
 #include <glm/ext/vector_float3.hpp>
 #include <memory>
@@ -22,17 +26,25 @@ private:
   bool m_paused = false;
   std::shared_ptr<Camera> m_camera;
   std::shared_ptr<ActionController<SceneActions>> m_actionController;
-  std::unique_ptr<OpenGLRenderer> m_renderer;
-  std::unique_ptr<CollisionSystem> m_collisionSystem;
-  sf::RenderWindow& m_window;
+  std::unique_ptr<Renderer> m_renderer; // OpenGLRenderer, or NullRenderer when headless
+  sf::RenderWindow* m_window;           // nullptr when headless
+  NullRenderer* m_headlessRenderer = nullptr; // m_renderer, when headless
   
   // New physics systems
   std::unique_ptr<CollisionDetectionSystem> m_collisionDetectionSystem;
   std::unique_ptr<CollisionResolutionSystem> m_collisionResolutionSystem;
   std::unique_ptr<BoundarySystem> m_boundarySystem;
   std::unique_ptr<MovementSystem> m_movementSystem;
+  std::unique_ptr<TransformSystem> m_transformSystem;
+  JobSystem* m_jobs; // Engine-wide pool shared by the physics systems (may be null)
+  SystemScheduler m_physicsSchedule;      // Orders the systems above by declared access
+  std::vector<CollisionEvent> m_collisions; // Detection -> resolution, each frame
+  bool m_scheduleLogged = false;
+  TransformInterpolator m_interpolator; // Pre-tick snapshot for rendering between ticks
+  void buildPhysicsSchedule();
   
-  void spawnTriangle();
+  void initSimulation(size_t entityCount);
+  void spawnTriangle(size_t count);
   Vec2f m_window_size;
   EntityManager m_entityManager;
   void sMovement(float deltaTime);
@@ -56,6 +68,7 @@ private:
   // Grid rendering
   bool m_gridVisible = EngineConstants::UI::GRID_3D_DEFAULT_VISIBLE;
   bool m_gridCreated = false;
+  LineBatch m_gridLines; // Uploaded once to the renderer's static line buffer
   void toggleGrid();
   void createGrid();
   void destroyGrid();
@@ -65,17 +78,27 @@ public:
   void onUnload() override;
   void update(float deltaTime) override;
   void sRender() override;
+  void setRenderInterpolation(float alpha) override;
   void onLoad() override;
   void processInput(const InputEvent &event, float deltaTime = 0.0f) override;
   void sInput(sf::Event &event, float deltaTime) override;
 
   std::unordered_map<InputEvent, SceneActions> m_inputMap;
   // not all scenes will require a player pointer
-  explicit GameScene(sf::RenderWindow &window);
+  // jobs: worker pool for data-parallel physics; must outlive the scene
+  explicit GameScene(sf::RenderWindow &window, JobSystem *jobs = nullptr);
+  // Headless: no window or GL context, draws through a NullRenderer
+  GameScene(JobSystem *jobs, size_t entityCount);
 
   std::shared_ptr<Camera> camera();
   std::shared_ptr<ActionController<SceneActions>> actionController();
 
+  // Physics systems in run order, with per-system timings from the last tick
+  SystemScheduler &physicsSchedule() { return m_physicsSchedule; }
+  size_t entityCount() const { return m_entityManager.getEntities().size(); }
+  // nullptr unless constructed headless
+  const NullRenderer *headlessRenderer() const { return m_headlessRenderer; }
+
   void togglePaused();
   bool isPaused();
 };
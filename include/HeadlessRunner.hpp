@@ -0,0 +1,57 @@
+#pragma once
+#include "Constants.hpp"
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * HeadlessRunner - Runs the GameScene simulation without a window
+ *
+ * Builds a GameScene with a NullRenderer, spawns the requested number of
+ * entities and runs a fixed number of ticks back to back (no frame limit,
+ * no vsync), timing the whole run and each physics system. Used by the
+ * `headless` build target for throughput runs and by tests.
+ *
+ * Usage:
+ *   HeadlessRunner::Options options;
+ *   options.entities = 8000;
+ *   HeadlessRunner::Report report = HeadlessRunner::run(options);
+ *   HeadlessRunner::printReport(report, std::cout);
+ */
+class HeadlessRunner {
+public:
+    struct Options {
+        size_t entities = 1000;
+        size_t ticks = 1000;
+        size_t threads = 0;  // Total threads including the caller; 0 = hardware default
+        float tickRate = EngineConstants::Physics::TICK_RATE;
+    };
+
+    struct SystemTiming {
+        std::string name;
+        double totalMs = 0.0;
+        double averageMs = 0.0; // Per tick
+        double share = 0.0;     // Fraction of the summed system time
+    };
+
+    struct Report {
+        Options options;
+        size_t threads = 0;       // Threads actually used
+        size_t entities = 0;      // Alive after the last tick
+        size_t ticks = 0;
+        size_t framesRendered = 0;
+        double totalMs = 0.0;
+        double ticksPerSecond = 0.0;
+        std::vector<SystemTiming> systems; // In registration order
+    };
+
+    /**
+     * @brief Run options.ticks simulation ticks as fast as possible
+     * Only one scene may exist at a time (components are global), so no
+     * other EntityManager may be alive during the call.
+     */
+    static Report run(const Options& options);
+
+    static void printReport(const Report& report, std::ostream& out);
+};
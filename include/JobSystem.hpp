@@ -0,0 +1,195 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+class JobCounter;
+
+/**
+ * Unit of work queued in a JobSystem (internal; build jobs through
+ * parallelFor/parallelForRange/submit)
+ *
+ * Range jobs cover [begin, end) and are halved until they fit in
+ * `grain`, pushing the upper halves for other threads to steal.
+ */
+struct Job {
+    using Fn = void (*)(void* context, size_t begin, size_t end, size_t thread);
+
+    Fn fn = nullptr;
+    void* context = nullptr;
+    size_t begin = 0;
+    size_t end = 0;
+    size_t grain = 1;
+    JobCounter* counter = nullptr; // Decremented when this job (or split half) finishes
+};
+
+/**
+ * JobCounter - Completion counter for a group of jobs
+ *
+ * Every job submitted with a counter increments it and decrements it
+ * when done. JobSystem::wait(counter) returns once it reaches zero, and
+ * jobs submitted with `after = &counter` are held back until then.
+ * A counter must outlive its jobs and may be reused once done.
+ */
+class JobCounter {
+public:
+    JobCounter() = default;
+    JobCounter(const JobCounter&) = delete;
+    JobCounter& operator=(const JobCounter&) = delete;
+
+    bool isDone() const { return m_pending.load(std::memory_order_acquire) == 0; }
+
+private:
+    friend class JobSystem;
+
+    std::atomic<size_t> m_pending{0};
+    std::mutex m_mutex;               // Guards m_continuations against the final decrement
+    std::vector<Job> m_continuations; // Jobs waiting for this counter to reach zero
+};
+
+/**
+ * JobSystem - Work-stealing scheduler over a fixed pool of worker threads
+ *
+ * Every thread that runs jobs has its own deque: it pushes and pops work
+ * at the back (LIFO, cache-warm), while idle threads steal from the
+ * front of the others (FIFO, the largest remaining ranges). Index 0 is
+ * the thread that owns the system (the main thread); workers are
+ * 1..getWorkerCount().
+ *
+ * - parallelFor / parallelForRange split an index range recursively and
+ *   return when all of it has run; the caller works too
+ * - submit() queues a single task on a JobCounter, optionally only after
+ *   another counter finishes; wait() helps run jobs until it is done
+ * - getCurrentThreadIndex() is stable within a job and never shared by
+ *   two concurrently running jobs, so per-thread scratch needs no locks
+ *
+ * parallelFor never allocates once the deques have grown; submit()
+ * allocates its closure. Only the owning thread and jobs themselves may
+ * call into the system. A job that waits (including a nested
+ * parallelFor) may run other jobs on its thread before returning, so it
+ * must not hold per-thread scratch across the wait.
+ *
+ * Usage:
+ *   JobSystem jobs;  // hardware_concurrency() - 1 workers
+ *   jobs.parallelFor(chunks, [&](size_t chunk, size_t thread) { ... });
+ *
+ *   JobCounter loaded;
+ *   jobs.submit(loaded, [&]() { loadTiles(); });
+ *   jobs.submit(built, [&]() { buildMesh(); }, &loaded);
+ *   jobs.wait(built);
+ */
+class JobSystem {
+public:
+    /**
+     * @brief Start the worker threads
+     * @param workerCount Threads besides the owner (0 = run everything inline)
+     */
+    explicit JobSystem(size_t workerCount = defaultWorkerCount());
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    /**
+     * @brief One worker per hardware thread, minus the owner's
+     */
+    static size_t defaultWorkerCount();
+
+    size_t getWorkerCount() const { return m_workers.size(); }
+
+    /**
+     * @brief Threads that run jobs (workers + owner)
+     */
+    size_t getThreadCount() const { return m_workers.size() + 1; }
+
+    /**
+     * @brief Index of the calling thread in [0, getThreadCount()); 0 outside the pool
+     */
+    size_t getCurrentThreadIndex() const;
+
+    /**
+     * @brief Run fn(begin, end, thread) over [0, count) in chunks of at most grain, and wait
+     */
+    template <typename Fn>
+    void parallelForRange(size_t count, size_t grain, Fn&& fn) {
+        if (count == 0) {
+            return;
+        }
+        if (m_workers.empty() || count <= grain) {
+            fn(size_t(0), count, getCurrentThreadIndex());
+            return;
+        }
+        using FnType = std::remove_reference_t<Fn>;
+        JobCounter counter;
+        Job job;
+        job.fn = [](void* context, size_t begin, size_t end, size_t thread) {
+            (*static_cast<FnType*>(context))(begin, end, thread);
+        };
+        job.context = const_cast<void*>(static_cast<const void*>(&fn));
+        job.begin = 0;
+        job.end = count;
+        job.grain = grain > 0 ? grain : 1;
+        runAndWait(job, counter);
+    }
+
+    /**
+     * @brief Run fn(index, thread) for every index in [0, count), and wait
+     */
+    template <typename Fn>
+    void parallelFor(size_t count, Fn&& fn) {
+        parallelForRange(count, 1, [&fn](size_t begin, size_t end, size_t thread) {
+            for (size_t i = begin; i < end; ++i) {
+                fn(i, thread);
+            }
+        });
+    }
+
+    /**
+     * @brief Queue fn() on counter, to start once `after` (if any) is done
+     */
+    template <typename Fn>
+    void submit(JobCounter& counter, Fn&& fn, JobCounter* after = nullptr) {
+        using Task = std::decay_t<Fn>;
+        Job job;
+        job.fn = [](void* context, size_t, size_t, size_t) {
+            std::unique_ptr<Task> task(static_cast<Task*>(context));
+            (*task)();
+        };
+        job.context = new Task(std::forward<Fn>(fn));
+        job.end = 1;
+        job.counter = &counter;
+        enqueue(job, after);
+    }
+
+    /**
+     * @brief Run queued jobs on this thread until counter is done
+     */
+    void wait(JobCounter& counter);
+
+private:
+    struct WorkQueue;
+
+    void enqueue(Job job, JobCounter* after);
+    void runAndWait(Job job, JobCounter& counter);
+    void execute(Job job, size_t thread);
+    void finish(JobCounter& counter, size_t thread);
+    void push(size_t thread, const Job& job);
+    bool findJob(size_t thread, Job& job);
+    void workerLoop(size_t thread);
+
+    std::vector<std::unique_ptr<WorkQueue>> m_queues; // One per thread, index 0 = owner
+    std::vector<std::thread> m_workers;
+
+    std::atomic<size_t> m_queuedJobs{0};
+    std::mutex m_sleepMutex;
+    std::condition_variable m_wake; // Job queued, counter finished, or shutdown
+    bool m_stopping = false;
+};
@@ -0,0 +1,67 @@
+#pragma once
+#include <cstddef>
+#include <glm/glm.hpp>
+#include <vector>
+
+/**
+ * LineBatch - CPU-side list of colored line segments, ready for one upload
+ *
+ * Lines are stored as interleaved GL_LINES vertices in the renderer's
+ * vertex layout (position(3) + color(3)), so the whole batch uploads with
+ * a single buffer call. Consecutive lines of the same width are merged
+ * into one Run; since line width is GL state, each run is one draw call.
+ *
+ * Usage:
+ *   LineBatch grid;
+ *   grid.addLine(start, end, color, 2.0f);
+ *   renderer->setStaticLines(grid);   // or per frame: renderer->drawLine(...)
+ */
+class LineBatch {
+public:
+    static constexpr size_t FLOATS_PER_VERTEX = 6;
+    static constexpr size_t VERTICES_PER_LINE = 2;
+
+    /**
+     * Lines [firstVertex, firstVertex + vertexCount) share one width
+     */
+    struct Run {
+        float width;
+        size_t firstVertex;
+        size_t vertexCount;
+    };
+
+    /**
+     * @brief Append a segment
+     * @param width Line width in pixels
+     */
+    void addLine(const glm::vec3& start, const glm::vec3& end, const glm::vec3& color,
+                 float width = 1.0f) {
+        if (m_runs.empty() || m_runs.back().width != width) {
+            m_runs.push_back(Run{width, vertexCount(), 0});
+        }
+        m_runs.back().vertexCount += VERTICES_PER_LINE;
+        m_vertices.insert(m_vertices.end(), {start.x, start.y, start.z, color.r, color.g, color.b,
+                                             end.x, end.y, end.z, color.r, color.g, color.b});
+    }
+
+    /**
+     * @brief Remove all lines, keeping the allocation for the next frame
+     */
+    void clear() {
+        m_vertices.clear();
+        m_runs.clear();
+    }
+
+    void reserve(size_t lines) { m_vertices.reserve(lines * VERTICES_PER_LINE * FLOATS_PER_VERTEX); }
+
+    bool empty() const { return m_vertices.empty(); }
+    size_t lineCount() const { return vertexCount() / VERTICES_PER_LINE; }
+    size_t vertexCount() const { return m_vertices.size() / FLOATS_PER_VERTEX; }
+
+    const std::vector<float>& vertices() const { return m_vertices; }
+    const std::vector<Run>& runs() const { return m_runs; }
+
+private:
+    std::vector<float> m_vertices;
+    std::vector<Run> m_runs;
+};
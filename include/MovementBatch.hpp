@@ -0,0 +1,195 @@
+#pragma once
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+#include <glm/glm.hpp>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+/**
+ * Batched Euler integration over structure-of-arrays movers
+ *
+ * Holds position, velocity and acceleration as nine float streams plus
+ * an optional per-mover speed limit, and integrates all of them in one
+ * pass, 8 (AVX2) or 4 (SSE2) movers at a time:
+ *
+ *   vel += acc * dt
+ *   if |vel| > maxSpeed: vel *= maxSpeed / |vel|
+ *   pos += vel * dt
+ *
+ * Kernel selection is compile-time like AABBBatch; the scalar loop is
+ * the reference and handles the tail. Movers without a limit use an
+ * infinite maxSpeed, which never clamps.
+ */
+class MovementBatch {
+public:
+    static constexpr float NO_SPEED_LIMIT = std::numeric_limits<float>::infinity();
+
+    /**
+     * @brief Remove all movers (keeps capacity, so refills do not allocate)
+     */
+    void clear() {
+        for (std::vector<float>* stream : streams()) {
+            stream->clear();
+        }
+    }
+
+    void reserve(size_t count) {
+        for (std::vector<float>* stream : streams()) {
+            stream->reserve(count);
+        }
+    }
+
+    /**
+     * @brief Append a mover; its index is the previous size()
+     */
+    void push_back(const glm::vec3& position, const glm::vec3& velocity,
+                   const glm::vec3& acceleration, float maxSpeed = NO_SPEED_LIMIT) {
+        m_posX.push_back(position.x);
+        m_posY.push_back(position.y);
+        m_posZ.push_back(position.z);
+        m_velX.push_back(velocity.x);
+        m_velY.push_back(velocity.y);
+        m_velZ.push_back(velocity.z);
+        m_accX.push_back(acceleration.x);
+        m_accY.push_back(acceleration.y);
+        m_accZ.push_back(acceleration.z);
+        m_maxSpeed.push_back(maxSpeed);
+    }
+
+    size_t size() const { return m_posX.size(); }
+    bool empty() const { return m_posX.empty(); }
+
+    glm::vec3 position(size_t i) const { return glm::vec3(m_posX[i], m_posY[i], m_posZ[i]); }
+    glm::vec3 velocity(size_t i) const { return glm::vec3(m_velX[i], m_velY[i], m_velZ[i]); }
+
+    /**
+     * @brief Integrate every mover by deltaTime
+     * @param limitSpeed False skips the speed-limit step (all limits infinite)
+     */
+    void integrate(float deltaTime, bool limitSpeed) {
+        size_t first = 0;
+#if defined(__AVX2__)
+        first = integrateAVX2(deltaTime, limitSpeed);
+#elif defined(__SSE2__) || defined(_M_X64)
+        first = integrateSSE(deltaTime, limitSpeed);
+#endif
+        integrateScalar(deltaTime, limitSpeed, first);
+    }
+
+    /**
+     * @brief Reference implementation of integrate() over movers [first, size())
+     */
+    void integrateScalar(float deltaTime, bool limitSpeed, size_t first = 0) {
+        for (size_t i = first; i < size(); ++i) {
+            float vx = m_velX[i] + m_accX[i] * deltaTime;
+            float vy = m_velY[i] + m_accY[i] * deltaTime;
+            float vz = m_velZ[i] + m_accZ[i] * deltaTime;
+            if (limitSpeed) {
+                float speed = std::sqrt(vx * vx + vy * vy + vz * vz);
+                if (speed > m_maxSpeed[i]) {
+                    float scale = m_maxSpeed[i] / speed;
+                    vx *= scale;
+                    vy *= scale;
+                    vz *= scale;
+                }
+            }
+            m_velX[i] = vx;
+            m_velY[i] = vy;
+            m_velZ[i] = vz;
+            m_posX[i] += vx * deltaTime;
+            m_posY[i] += vy * deltaTime;
+            m_posZ[i] += vz * deltaTime;
+        }
+    }
+
+    /**
+     * @brief Name of the kernel integrate() compiles to (for benchmarks/logs)
+     */
+    static const char* kernelName() {
+#if defined(__AVX2__)
+        return "AVX2";
+#elif defined(__SSE2__) || defined(_M_X64)
+        return "SSE2";
+#else
+        return "scalar";
+#endif
+    }
+
+private:
+    std::array<std::vector<float>*, 10> streams() {
+        return {&m_posX, &m_posY, &m_posZ, &m_velX, &m_velY, &m_velZ,
+                &m_accX, &m_accY, &m_accZ, &m_maxSpeed};
+    }
+
+#if defined(__AVX2__)
+    // Returns the first mover left for the scalar tail
+    size_t integrateAVX2(float deltaTime, bool limitSpeed) {
+        const __m256 dt = _mm256_set1_ps(deltaTime);
+        size_t i = 0;
+        for (; i + 8 <= size(); i += 8) {
+            __m256 vx = _mm256_add_ps(_mm256_loadu_ps(&m_velX[i]), _mm256_mul_ps(_mm256_loadu_ps(&m_accX[i]), dt));
+            __m256 vy = _mm256_add_ps(_mm256_loadu_ps(&m_velY[i]), _mm256_mul_ps(_mm256_loadu_ps(&m_accY[i]), dt));
+            __m256 vz = _mm256_add_ps(_mm256_loadu_ps(&m_velZ[i]), _mm256_mul_ps(_mm256_loadu_ps(&m_accZ[i]), dt));
+            if (limitSpeed) {
+                __m256 speed = _mm256_sqrt_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vx, vx), _mm256_mul_ps(vy, vy)),
+                                                            _mm256_mul_ps(vz, vz)));
+                __m256 maxSpeed = _mm256_loadu_ps(&m_maxSpeed[i]);
+                __m256 over = _mm256_cmp_ps(speed, maxSpeed, _CMP_GT_OQ);
+                __m256 scale = _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_div_ps(maxSpeed, speed), over);
+                vx = _mm256_mul_ps(vx, scale);
+                vy = _mm256_mul_ps(vy, scale);
+                vz = _mm256_mul_ps(vz, scale);
+            }
+            _mm256_storeu_ps(&m_velX[i], vx);
+            _mm256_storeu_ps(&m_velY[i], vy);
+            _mm256_storeu_ps(&m_velZ[i], vz);
+            _mm256_storeu_ps(&m_posX[i], _mm256_add_ps(_mm256_loadu_ps(&m_posX[i]), _mm256_mul_ps(vx, dt)));
+            _mm256_storeu_ps(&m_posY[i], _mm256_add_ps(_mm256_loadu_ps(&m_posY[i]), _mm256_mul_ps(vy, dt)));
+            _mm256_storeu_ps(&m_posZ[i], _mm256_add_ps(_mm256_loadu_ps(&m_posZ[i]), _mm256_mul_ps(vz, dt)));
+        }
+        return i;
+    }
+#elif defined(__SSE2__) || defined(_M_X64)
+    // Returns the first mover left for the scalar tail
+    size_t integrateSSE(float deltaTime, bool limitSpeed) {
+        const __m128 dt = _mm_set1_ps(deltaTime);
+        size_t i = 0;
+        for (; i + 4 <= size(); i += 4) {
+            __m128 vx = _mm_add_ps(_mm_loadu_ps(&m_velX[i]), _mm_mul_ps(_mm_loadu_ps(&m_accX[i]), dt));
+            __m128 vy = _mm_add_ps(_mm_loadu_ps(&m_velY[i]), _mm_mul_ps(_mm_loadu_ps(&m_accY[i]), dt));
+            __m128 vz = _mm_add_ps(_mm_loadu_ps(&m_velZ[i]), _mm_mul_ps(_mm_loadu_ps(&m_accZ[i]), dt));
+            if (limitSpeed) {
+                __m128 speed = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)),
+                                                      _mm_mul_ps(vz, vz)));
+                __m128 maxSpeed = _mm_loadu_ps(&m_maxSpeed[i]);
+                __m128 over = _mm_cmpgt_ps(speed, maxSpeed);
+                // SSE2 has no blend: select by mask
+                __m128 scale = _mm_or_ps(_mm_and_ps(over, _mm_div_ps(maxSpeed, speed)),
+                                         _mm_andnot_ps(over, _mm_set1_ps(1.0f)));
+                vx = _mm_mul_ps(vx, scale);
+                vy = _mm_mul_ps(vy, scale);
+                vz = _mm_mul_ps(vz, scale);
+            }
+            _mm_storeu_ps(&m_velX[i], vx);
+            _mm_storeu_ps(&m_velY[i], vy);
+            _mm_storeu_ps(&m_velZ[i], vz);
+            _mm_storeu_ps(&m_posX[i], _mm_add_ps(_mm_loadu_ps(&m_posX[i]), _mm_mul_ps(vx, dt)));
+            _mm_storeu_ps(&m_posY[i], _mm_add_ps(_mm_loadu_ps(&m_posY[i]), _mm_mul_ps(vy, dt)));
+            _mm_storeu_ps(&m_posZ[i], _mm_add_ps(_mm_loadu_ps(&m_posZ[i]), _mm_mul_ps(vz, dt)));
+        }
+        return i;
+    }
+#endif
+
+    std::vector<float> m_posX, m_posY, m_posZ;
+    std::vector<float> m_velX, m_velY, m_velZ;
+    std::vector<float> m_accX, m_accY, m_accZ;
+    std::vector<float> m_maxSpeed;
+};
@@ -2,15 +2,36 @@
 
 #include "Component.h"
 #include "EntityManager.h"
+#include "JobSystem.hpp"
+#include "MovementBatch.hpp"
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 class MovementSystem {
 public:
     MovementSystem() = default;
     ~MovementSystem() = default;
 
+    /**
+     * @brief Integrate every entity with CTransform3D + CMovement3D
+     *
+     * Pending forces are applied first on the calling thread; the
+     * per-entity integration then runs across the job system if one is set.
+     *
+     * Integration stays in place on the component arrays: gathering
+     * CTransform3D/CMovement3D into MovementBatch streams and scattering
+     * back costs more than the arithmetic it vectorises (see
+     * bench/movement_integration_bench.cpp). MovementBatch is for movers
+     * whose state already lives in SoA streams.
+     */
     void updateMovement(EntityManager& entityManager, float deltaTime);
     
+    /**
+     * @brief Run integration data-parallel on jobs (nullptr = calling thread only)
+     */
+    void setJobSystem(JobSystem* jobs) { m_jobs = jobs; }
+    
     void applyImpulse(std::shared_ptr<Entity> entity, const glm::vec3& impulse);
     
     void setVelocity(std::shared_ptr<Entity> entity, const glm::vec3& velocity);
@@ -22,14 +43,26 @@ public:
     void applyDamping(std::shared_ptr<Entity> entity, float dampingFactor);
 
 private:
-    void updatePosition(std::shared_ptr<Entity> entity, float deltaTime);
-    
-    void updateVelocity(std::shared_ptr<Entity> entity, float deltaTime);
+    void applyPendingForces(float deltaTime);
     
-    void applySpeedLimit(std::shared_ptr<Entity> entity);
+    /**
+     * @brief Drop speed limits and pending forces whose entity is gone
+     *
+     * IDs are recycled, so per-ID state is stored with the handle it was
+     * set for; once that handle no longer resolves, the slot belongs to a
+     * different entity (or none) and the state is reset.
+     */
+    void dropStaleEntries(const EntityManager& entityManager);
     
-    void applyRotation(std::shared_ptr<Entity> entity, float deltaTime);
+    JobSystem* m_jobs = nullptr;
     
-    std::unordered_map<size_t, float> m_entityMaxSpeeds;
-    std::unordered_map<size_t, glm::vec3> m_accumulatedForces;
+    // Dense per-entity state, indexed by entity ID (IDs are recycled slot indices)
+    std::vector<float> m_maxSpeeds;          // MovementBatch::NO_SPEED_LIMIT when unset
+    std::vector<EntityHandle> m_limitOwners; // Entity each speed limit was set for
+    std::vector<size_t> m_limitedEntities;   // IDs with a speed limit set
+    bool m_hasSpeedLimits = false;
+    std::vector<glm::vec3> m_pendingForces;  // Summed since the last update
+    std::vector<uint8_t> m_hasPendingForce;
+    std::vector<EntityHandle> m_forceOwners; // Entity each pending force was added for
+    std::vector<size_t> m_forcedEntities;    // IDs with m_hasPendingForce set
 };
\ No newline at end of file
@@ -0,0 +1,27 @@
+#pragma once
+#include "Renderer.h"
+#include <cstddef>
+
+/**
+ * NullRenderer - Renderer that draws nothing
+ *
+ * Stands in for OpenGLRenderer when there is no window or GPU (headless
+ * runs, CI). It only counts what it was asked to draw, so callers can
+ * check the render path ran.
+ */
+class NullRenderer : public Renderer {
+public:
+  void init() override {};
+  void render() override { m_frames++; };
+  void render(const EntityVec &entities) override {
+    m_frames++;
+    m_entitiesSubmitted += entities.size();
+  };
+
+  size_t getFrameCount() const { return m_frames; }
+  size_t getEntitiesSubmitted() const { return m_entitiesSubmitted; }
+
+private:
+  size_t m_frames = 0;
+  size_t m_entitiesSubmitted = 0;
+};
@@ -1,49 +1,21 @@
 #pragma once
 #include "./Renderer.h"
 #include "Camera.h"
+#include "GLCheck.hpp"
 #include "EntityManager.h"
+#include "Frustum.hpp"
+#include "LineBatch.hpp"
+#include "RenderQueue.hpp"
+#include "ShaderProgram.hpp"
+#include "SpatialPartition.hpp"
+#include "TransformInterpolator.hpp"
+#include "TransformSystem.hpp"
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Window.hpp>
 #include <glad/glad.h>
 #include <memory>
 #include <iostream>
-
-// OpenGL Error Checking Macros
-// These provide immediate feedback when OpenGL calls fail, making debugging much easier
-#ifdef DEBUG
-    #define GL_CHECK_ERROR() \
-        do { \
-            GLenum error = glGetError(); \
-            if (error != GL_NO_ERROR) { \
-                std::cerr << "OpenGL Error: 0x" << std::hex << error << std::dec \
-                         << " (" << getGLErrorString(error) << ")" \
-                         << " at " << __FILE__ << ":" << __LINE__ << std::endl; \
-            } \
-        } while(0)
-#else
-    #define GL_CHECK_ERROR() // No-op in release builds for zero performance cost
-#endif
-
-// Convenience macro for OpenGL function calls with automatic error checking
-#define GL_CALL(call) \
-    do { \
-        call; \
-        GL_CHECK_ERROR(); \
-    } while(0)
-
-// Helper function to convert OpenGL error codes to readable strings
-inline const char* getGLErrorString(GLenum error) {
-    switch(error) {
-        case GL_NO_ERROR:          return "GL_NO_ERROR";
-        case GL_INVALID_ENUM:      return "GL_INVALID_ENUM";
-        case GL_INVALID_VALUE:     return "GL_INVALID_VALUE";
-        case GL_INVALID_OPERATION: return "GL_INVALID_OPERATION";
-        case GL_OUT_OF_MEMORY:     return "GL_OUT_OF_MEMORY";
-        case GL_STACK_OVERFLOW:    return "GL_STACK_OVERFLOW";
-        case GL_STACK_UNDERFLOW:   return "GL_STACK_UNDERFLOW";
-        default:                   return "UNKNOWN_ERROR";
-    }
-}
+#include <vector>
 
 class OpenGLRenderer : public Renderer {
 public:
@@ -64,28 +36,94 @@ public:
   void render(const EntityVec &entities) override;
   std::shared_ptr<Camera> camera();
   
+  /**
+   * @brief Draw entities at interpolated transforms (nullptr = latest simulation state)
+   * @param interpolator Owned by the scene; must outlive the renderer or be reset
+   */
+  void setInterpolator(const TransformInterpolator *interpolator) override {
+    m_interpolator = interpolator;
+  }
+  
   /**
    * @brief Clean up OpenGL resources and reset state
    * 
    * Properly deletes VAOs, VBOs, and shader programs to prevent memory leaks.
    * Safe to call multiple times.
    */
-  void onUnload();
+  void onUnload() override;
+
+  /**
+   * @brief Replace the static lines; uploaded to their own VBO on the next render
+   */
+  void setStaticLines(const LineBatch &lines) override;
+
+  void drawLine(const glm::vec3 &start, const glm::vec3 &end,
+                const glm::vec3 &color, float width) override;
+
+  /**
+   * @brief Cull triangles with this partition's query instead of a linear scan
+   * @param partition Broadphase kept in sync with entity CAABBs (nullptr = scan)
+   *
+   * Only the partition's candidates are considered, so triangles entirely
+   * outside its world bounds are not drawn.
+   */
+  void setCullingPartition(const SpatialPartitionStrategy *partition) override {
+    m_cullPartition = partition;
+  }
+
+  /**
+   * @brief Frustum culling counts for the last rendered frame
+   */
+  struct CullStats {
+    size_t tested = 0; // Triangles whose bounding sphere was tested
+    size_t culled = 0; // Rejected as outside the frustum
+    size_t drawn = 0;  // Submitted to the render queue
+    bool usedPartition = false;
+  };
+  const CullStats &getCullStats() const { return m_cullStats; }
+
+  /**
+   * @brief Programs by name ("color", "instanced"), loaded in init()
+   */
+  ShaderRegistry &shaders() { return m_shaders; }
 
 private:
   sf::RenderWindow &m_window;
-  unsigned int VAO, VBO, shaderProgram;
+  unsigned int VAO, VBO;
   bool m_initialized;
-  
-  /**
-   * @brief Compile GLSL shader source code
-   * @param source Null-terminated shader source code
-   * @param type GL_VERTEX_SHADER or GL_FRAGMENT_SHADER
-   * @return OpenGL shader ID, or 0 if compilation failed
-   * 
-   * Handles compilation errors and logs detailed error messages.
-   */
-  unsigned int compileShader(const char *source, GLenum type);
+  const TransformInterpolator *m_interpolator = nullptr;
+
+  ShaderRegistry m_shaders;
+  ShaderProgram *m_colorShader = nullptr;     // Per-draw model uniform
+  ShaderProgram *m_instancedShader = nullptr; // Per-instance model attribute
+  GLint m_colorModelLoc = -1;
+  unsigned int m_cameraUBO = 0; // view + projection, uploaded once per frame
+
+  // Debug lines: static ones live in their own VBO until replaced; per-frame
+  // ones (drawLine, CGridLine entities) stream through VBO each frame
+  unsigned int m_staticLineVAO = 0, m_staticLineVBO = 0;
+  LineBatch m_staticLines;
+  bool m_staticLinesDirty = false;
+  LineBatch m_frameLines;
+
+  // Instanced triangles: the shared CTriangle mesh is uploaded once, and
+  // each frame's model matrices are streamed into an orphaned instance VBO
+  unsigned int m_triangleVAO = 0, m_meshVBO = 0, m_instanceVBO = 0;
+  std::vector<float> m_sharedMesh;          // Vertices of a default CTriangle
+  std::vector<glm::mat4> m_instanceModels;  // Upload staging, in draw order
+  size_t m_instanceCapacity = 0;            // Instance VBO size, in matrices
+
+  // Triangle render queue: one command per triangle, indexing the model
+  // matrix and source entity collected this frame
+  RenderQueue m_queue;
+  std::vector<glm::mat4> m_models;
+  std::vector<EntityID> m_modelSources;
+
+  // Frustum culling: candidates come from the partition when one is set
+  const SpatialPartitionStrategy *m_cullPartition = nullptr;
+  std::vector<EntityID> m_candidates;
+  float m_sharedMeshRadius = 0.0f; // Bounding sphere of the shared mesh
+  CullStats m_cullStats;
   
   /**
    * @brief Set up vertex array objects and buffer objects for rendering
@@ -94,12 +132,61 @@ private:
    * Must be called after OpenGL context is active.
    */
   void setupBuffers();
+
+  /**
+   * @brief Queue every visible triangle, sort by (shader, mesh, depth), and draw
+   * @param view Camera view matrix, for front-to-back depth keys
+   * @param projection Camera projection matrix, for the culling frustum
+   *
+   * Shader and VAO binds happen only where the sorted keys change.
+   */
+  void renderTriangles(const EntityVec &entities, const glm::mat4 &view,
+                       const glm::mat4 &projection);
+
+  /**
+   * @brief Queue one triangle unless its bounding sphere is outside the frustum
+   * @param cached The entity's CModelMatrix, or nullptr if it has none
+   *
+   * The cached matrix is used when it is current (transform not dirty) and
+   * not being interpolated; otherwise the matrix is built for this frame.
+   */
+  void submitTriangle(EntityID id, const CTriangle &triangle,
+                      const CTransform3D &transform,
+                      const CModelMatrix *cached, const Frustum &frustum,
+                      const glm::mat4 &view);
+
+  /**
+   * @brief Distance from the model origin to the furthest vertex
+   */
+  static float meshRadius(const std::vector<float> &vertices);
+
+  /**
+   * @brief Draw queued shared-mesh triangles [begin, end) in one instanced call
+   */
+  void drawInstancedTriangles(size_t begin, size_t end);
+
+  /**
+   * @brief Draw queued custom-mesh triangles [begin, end) one by one
+   */
+  void drawCustomTriangles(size_t begin, size_t end);
   
   /**
-   * @brief Render grid lines for debug visualization
+   * @brief Point attributes 0 (position) and 1 (color) at the bound VBO
+   *
+   * Layout shared by triangles and lines: VERTEX_STRIDE_SIZE floats per vertex.
+   */
+  void setupVertexAttributes();
+
+  /**
+   * @brief Draw the static lines, then this frame's lines (queued plus CGridLine entities)
    * @param entities Vector of entities to check for CGridLine components
-   * @param view View matrix from camera
-   * @param projection Projection matrix from camera
+   *
+   * Each batch is one upload and one GL_LINES draw per line width.
+   */
+  void renderLines(const EntityVec &entities);
+
+  /**
+   * @brief Issue one GL_LINES draw per run of the batch (VAO must be bound)
    */
-  void renderGridLines(const EntityVec &entities, const glm::mat4& view, const glm::mat4& projection);
+  void drawLineRuns(const LineBatch &lines);
 };
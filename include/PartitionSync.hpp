@@ -0,0 +1,153 @@
+#pragma once
+
+#include "EntityManager.h"
+#include "SpatialPartition.hpp"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * PartitionSync - Keeps a SpatialPartitionStrategy registered incrementally
+ *
+ * Replaces the clear-and-reinsert-every-frame pattern:
+ * - Entities join the partition once EntityManager::update() reports them
+ *   added, and leave it when it reports them removed (EntityListener)
+ * - sync() walks CTransform3D + CAABB once and only calls
+ *   partition.update() for entities whose world bounds changed
+ * - Strategies' update() only touch their structure when cell/node
+ *   coverage changes, so a mostly static scene costs a linear compare
+ *
+ * Per-entity state is kept in vectors indexed by entity ID (slot index),
+ * so no hashing happens on the per-frame path.
+ *
+ * Usage:
+ *   auto sync = PartitionSync::attach(partition, entityManager);
+ *   sync->sync(entityManager, computeBounds);  // once per frame
+ */
+class PartitionSync : public EntityListener {
+public:
+    /**
+     * @brief Work done by the last sync() call
+     */
+    struct SyncStats {
+        size_t visited = 0;   // Entities with CTransform3D + CAABB seen
+        size_t unchanged = 0; // Bounds identical to last frame, partition untouched
+        size_t updated = 0;   // partition.update() calls for moved entities
+        size_t inserted = 0;  // Newly registered entities
+        size_t removed = 0;   // Entities unregistered (lost components or rejected)
+    };
+
+private:
+    struct Entry {
+        CAABB bounds;
+        bool live = false;       // Added by EntityManager::update() and not yet removed
+        bool registered = false; // Currently inserted into the partition
+        uint32_t seenSync = 0;   // Last sync() pass that visited the entity
+    };
+
+    SpatialPartitionStrategy& m_partition;
+    const EntityManager* m_entityManager;
+    std::vector<Entry> m_entries; // Indexed by entity ID
+    size_t m_registeredCount = 0;
+    uint32_t m_syncPass = 0;
+    SyncStats m_lastStats;
+
+    PartitionSync(SpatialPartitionStrategy& partition, const EntityManager& entityManager);
+
+    Entry& entry(size_t entityID);
+    void unregister(size_t entityID);
+
+public:
+    /**
+     * @brief Create a sync bound to partition and subscribed to entityManager
+     * @param partition Partition to keep registered (must outlive the sync)
+     * @param entityManager Source of entities; its current entities are treated as live
+     * @return Shared sync object (the manager only holds it weakly)
+     *
+     * Clears partition so registrations start from a known state.
+     */
+    static std::shared_ptr<PartitionSync> attach(SpatialPartitionStrategy& partition,
+                                                 EntityManager& entityManager);
+
+    /**
+     * @brief Check if this sync is subscribed to the given manager
+     *
+     * Also asks the manager, so a new manager constructed at a dead one's
+     * address is not mistaken for the original.
+     */
+    bool isAttachedTo(const EntityManager& entityManager) const {
+        return m_entityManager == &entityManager && entityManager.hasListener(this);
+    }
+
+    void onEntityAdded(Entity& entity) override;
+    void onEntityRemoved(Entity& entity) override;
+
+    /**
+     * @brief Bring partition up to date with current component state
+     * @param entityManager Manager this sync is attached to
+     * @param computeBounds bool(const CTransform3D&, CAABB&, CAABB& worldBounds);
+     *        fills worldBounds, returns false to keep the entity out of the partition
+     */
+    template <typename BoundsFn>
+    void sync(EntityManager& entityManager, BoundsFn&& computeBounds) {
+        m_lastStats = SyncStats{};
+        if (++m_syncPass == 0) {
+            for (auto& e : m_entries) {
+                e.seenSync = 0;
+            }
+            m_syncPass = 1;
+        }
+
+        size_t registeredSeen = 0;
+        entityManager.view<CTransform3D, CAABB>().each(
+            [&](size_t entityID, const CTransform3D& transform, CAABB& aabb) {
+                Entry& e = entry(entityID);
+                if (!e.live) {
+                    return; // Pending entities join after EntityManager::update()
+                }
+                m_lastStats.visited++;
+
+                CAABB worldBounds;
+                if (!computeBounds(transform, aabb, worldBounds)) {
+                    if (e.registered) {
+                        unregister(entityID);
+                        m_lastStats.removed++;
+                    }
+                    return;
+                }
+
+                e.seenSync = m_syncPass;
+                if (!e.registered) {
+                    m_partition.insert(entityID, worldBounds);
+                    e.registered = true;
+                    e.bounds = worldBounds;
+                    m_registeredCount++;
+                    m_lastStats.inserted++;
+                } else if (e.bounds.min == worldBounds.min && e.bounds.max == worldBounds.max) {
+                    m_lastStats.unchanged++;
+                } else {
+                    m_partition.update(entityID, worldBounds);
+                    e.bounds = worldBounds;
+                    m_lastStats.updated++;
+                }
+                registeredSeen++;
+            });
+
+        // Registered but not visited: entity lost CTransform3D or CAABB
+        if (registeredSeen != m_registeredCount) {
+            for (size_t id = 0; id < m_entries.size(); ++id) {
+                if (m_entries[id].registered && m_entries[id].seenSync != m_syncPass) {
+                    unregister(id);
+                    m_lastStats.removed++;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Number of entities currently registered in the partition
+     */
+    size_t getRegisteredCount() const { return m_registeredCount; }
+
+    const SyncStats& getLastSyncStats() const { return m_lastStats; }
+};
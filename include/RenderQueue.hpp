@@ -0,0 +1,97 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+/**
+ * RenderCommand - One draw request in a RenderQueue
+ *
+ * `index` refers back into whatever list the backend collected the
+ * renderable from (an instance array, the entity vector, ...).
+ */
+struct RenderCommand {
+    uint64_t key;
+    uint32_t index;
+};
+
+/**
+ * RenderQueue - Sort-keyed draw submission shared by the renderer backends
+ *
+ * A frame is: clear(), submit() one command per visible renderable,
+ * sort(), then walk commands() and change GPU state only where the key's
+ * state bits change. Key layout, most significant first:
+ *
+ *   | layer 4 | shader 12 | mesh 16 | depth 32 |
+ *
+ * so commands group by layer, then shader, then mesh, and run in depth
+ * order within a group. Backends choose what the fields mean (the SFML
+ * backend uses submission order as "depth" to keep painter's order).
+ *
+ * sort() is a stable LSD radix sort on 8-bit digits. Digits that are the
+ * same for every command (e.g. one shader all frame) are skipped, so a
+ * single-shader frame costs 4 passes. Buffers are reused across frames.
+ */
+class RenderQueue {
+public:
+    static constexpr int DEPTH_BITS = 32;
+    static constexpr int MESH_BITS = 16;
+    static constexpr int SHADER_BITS = 12;
+    static constexpr int LAYER_BITS = 4;
+
+    static constexpr int MESH_SHIFT = DEPTH_BITS;
+    static constexpr int SHADER_SHIFT = MESH_SHIFT + MESH_BITS;
+    static constexpr int LAYER_SHIFT = SHADER_SHIFT + SHADER_BITS;
+
+    /**
+     * @brief Pack a sort key; fields wider than their bits are truncated
+     */
+    static uint64_t makeKey(uint32_t layer, uint32_t shader, uint32_t mesh, uint32_t depth) {
+        return (static_cast<uint64_t>(layer & ((1u << LAYER_BITS) - 1)) << LAYER_SHIFT) |
+               (static_cast<uint64_t>(shader & ((1u << SHADER_BITS) - 1)) << SHADER_SHIFT) |
+               (static_cast<uint64_t>(mesh & ((1u << MESH_BITS) - 1)) << MESH_SHIFT) |
+               static_cast<uint64_t>(depth);
+    }
+
+    static uint32_t layerOf(uint64_t key) { return static_cast<uint32_t>(key >> LAYER_SHIFT); }
+    static uint32_t shaderOf(uint64_t key) {
+        return static_cast<uint32_t>(key >> SHADER_SHIFT) & ((1u << SHADER_BITS) - 1);
+    }
+    static uint32_t meshOf(uint64_t key) {
+        return static_cast<uint32_t>(key >> MESH_SHIFT) & ((1u << MESH_BITS) - 1);
+    }
+
+    /**
+     * @brief Map a float depth to bits that sort in the same order as the float
+     * Nearer (smaller) depths sort first, negatives before positives.
+     */
+    static uint32_t depthBits(float depth) {
+        uint32_t bits;
+        std::memcpy(&bits, &depth, sizeof(bits));
+        return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+    }
+
+    void submit(uint64_t key, uint32_t index) { m_commands.push_back(RenderCommand{key, index}); }
+
+    void clear() { m_commands.clear(); }
+    void reserve(size_t commands) { m_commands.reserve(commands); }
+    size_t size() const { return m_commands.size(); }
+    bool empty() const { return m_commands.empty(); }
+
+    /**
+     * @brief Stable sort of the submitted commands by key
+     */
+    void sort();
+
+    const std::vector<RenderCommand>& commands() const { return m_commands; }
+
+    /**
+     * @brief Radix passes the last sort() ran (out of 8), for profiling
+     */
+    int getLastSortPasses() const { return m_lastSortPasses; }
+
+private:
+    std::vector<RenderCommand> m_commands;
+    std::vector<RenderCommand> m_scratch;
+    int m_lastSortPasses = 0;
+};
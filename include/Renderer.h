@@ -1,10 +1,25 @@
 #pragma once
 #include "EntityManager.h"
 
+class LineBatch;
+class SpatialPartitionStrategy;
+class TransformInterpolator;
+
 class Renderer {
 public:
   virtual ~Renderer() = default;
   virtual void init() = 0;
   virtual void render(const EntityVec &entities) = 0;
   virtual void render() = 0;
+  // Release GPU/window resources before the scene goes away
+  virtual void onUnload() {};
+  // Draw at interpolated transforms (nullptr = latest simulation state)
+  virtual void setInterpolator(const TransformInterpolator * /*interpolator*/) {};
+  // Lines kept on the GPU across frames (debug grid); re-uploaded only when set again
+  virtual void setStaticLines(const LineBatch & /*lines*/) {};
+  // Queue a line for the next render() only; width in pixels
+  virtual void drawLine(const glm::vec3 & /*start*/, const glm::vec3 & /*end*/,
+                        const glm::vec3 & /*color*/, float /*width*/) {};
+  // Broadphase to query for visible candidates (nullptr = test every entity)
+  virtual void setCullingPartition(const SpatialPartitionStrategy * /*partition*/) {};
 };
@@ -1,15 +1,26 @@
 #pragma once
 #include "../include/EntityManager.h"
 #include "../include/Renderer.h"
+#include "../include/RenderQueue.hpp"
+#include "../include/ShapeBatch.hpp"
 #include <SFML/Graphics/RenderWindow.hpp>
 
 class SFMLRenderer : public Renderer {
 private:
   sf::RenderWindow &m_window;
   
+  // Same submission path as OpenGLRenderer. 2D has no depth buffer, so the
+  // key's depth is the submission order and overlap stays painter's order.
+  RenderQueue m_queue;
+  
+  // Every shape of the frame, appended in queue order and drawn at once
+  ShapeBatch m_batch;
+  std::vector<Vec2f> m_circlePoints, m_circleFill, m_circleOutline; // Scratch
+  std::vector<Vec2f> m_dotTriangles; // Vertex marker for showVertices, at the origin
+  
   // Specialized rendering methods
-  void renderPolygon(const CComplexShape& complexShape, const CTransform& transform);
-  sf::ConvexShape createPolygonShape(const std::vector<Vec2f>& vertices);
+  void appendCircle(const sf::CircleShape &circle);
+  void appendPolygon(CComplexShape &complexShape, const CTransform &transform);
 
 public:
   explicit SFMLRenderer(sf::RenderWindow &window);
@@ -17,4 +28,9 @@ public:
   void init() override;
   void render() override;
   void render(const EntityVec &entities) override;
+  
+  /**
+   * @brief Triangles drawn by the last render() call, in its single draw
+   */
+  size_t getTriangleCount() const { return m_batch.triangleCount(); }
 };
@@ -0,0 +1,89 @@
+#pragma once
+#include "GLCheck.hpp"
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+/**
+ * ShaderProgram - Linked GLSL program with its uniform locations cached
+ *
+ * Compiles and links a vertex + fragment pair, then resolves every active
+ * uniform once, right after linking, so draws never call
+ * glGetUniformLocation. Look locations up once (uniformLocation) and pass
+ * them to the setters. Missing uniforms resolve to -1, which GL ignores.
+ * Requires a current GL context; the program is deleted on destruction.
+ */
+class ShaderProgram {
+public:
+  ShaderProgram(const std::string &name, const char *vertexSource,
+                const char *fragmentSource);
+  ~ShaderProgram();
+
+  ShaderProgram(const ShaderProgram &) = delete;
+  ShaderProgram &operator=(const ShaderProgram &) = delete;
+
+  void use() const;
+  bool isLinked() const { return m_linked; }
+  unsigned int id() const { return m_id; }
+  const std::string &name() const { return m_name; }
+
+  /**
+   * @brief Cached location of a uniform, or -1 if the program has none by that name
+   */
+  GLint uniformLocation(const std::string &uniform) const;
+
+  void setMat4(GLint location, const glm::mat4 &value) const;
+
+  /**
+   * @brief Attach a named uniform block to a UBO binding point (no-op if absent)
+   */
+  void bindUniformBlock(const std::string &block, GLuint bindingPoint) const;
+
+private:
+  std::string m_name;
+  unsigned int m_id = 0;
+  bool m_linked = false;
+  std::unordered_map<std::string, GLint> m_uniforms;
+
+  /**
+   * @brief Compile GLSL shader source code
+   * @return OpenGL shader ID; compile errors are logged
+   */
+  unsigned int compileShader(const char *source, GLenum type);
+  void cacheUniforms();
+};
+
+/**
+ * ShaderRegistry - Shader programs looked up by name
+ *
+ * Sources are read from disk when a program is loaded (not at static
+ * initialization), so code that never creates a renderer never needs
+ * the shader files.
+ *
+ * Usage:
+ *   ShaderProgram &color = registry.load("color", "./src/ColorShader.vert",
+ *                                        "./src/DepthFragment.frag");
+ *   ShaderProgram *same = registry.get("color");
+ */
+class ShaderRegistry {
+public:
+  /**
+   * @brief Compile and link a program from files, replacing any of the same name
+   * Throws std::runtime_error (from FileLoader) if a source file is missing.
+   */
+  ShaderProgram &load(const std::string &name, const std::string &vertexPath,
+                      const std::string &fragmentPath);
+
+  /**
+   * @brief Program registered under name, or nullptr
+   */
+  ShaderProgram *get(const std::string &name) const;
+
+  size_t size() const { return m_programs.size(); }
+  void clear() { m_programs.clear(); }
+
+private:
+  std::unordered_map<std::string, std::unique_ptr<ShaderProgram>> m_programs;
+};
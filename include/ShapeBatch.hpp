@@ -0,0 +1,126 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+/**
+ * ShapeBatch - 2D triangles from many shapes, drawn with one sf::VertexArray
+ *
+ * triangulate() turns a polygon into triangle lists the way sf::Shape
+ * does: the fill is a fan around the center of the polygon's bounds, and
+ * the outline is a band pushed out along each corner's mitred normal.
+ * Callers cache those lists and append() them each frame with a color
+ * (and optionally a transform). Triangles draw in append order, so
+ * overlapping shapes keep painter's order inside the single draw call.
+ *
+ * Usage:
+ *   ShapeBatch::triangulate(points, thickness, fill, outline); // when the points change
+ *   batch.append(fill, fillColor);
+ *   batch.append(outline, outlineColor);
+ *   window.draw(batch.vertices());
+ */
+class ShapeBatch {
+public:
+    static constexpr size_t VERTICES_PER_TRIANGLE = 3;
+
+    ShapeBatch() : m_vertices(sf::Triangles) {}
+
+    /**
+     * @brief Fill and outline triangle lists for a polygon (outline empty if thickness is 0)
+     * @param fill Receives 3 vertices per fan triangle
+     * @param outline Receives 6 vertices per edge
+     */
+    static void triangulate(const std::vector<sf::Vector2f>& points, float outlineThickness,
+                            std::vector<sf::Vector2f>& fill, std::vector<sf::Vector2f>& outline) {
+        fill.clear();
+        outline.clear();
+        const size_t count = points.size();
+        if (count < 3) {
+            return;
+        }
+
+        sf::Vector2f low = points[0], high = points[0];
+        for (const auto& point : points) {
+            low.x = std::min(low.x, point.x);
+            low.y = std::min(low.y, point.y);
+            high.x = std::max(high.x, point.x);
+            high.y = std::max(high.y, point.y);
+        }
+        const sf::Vector2f center((low.x + high.x) * 0.5f, (low.y + high.y) * 0.5f);
+
+        fill.reserve(count * VERTICES_PER_TRIANGLE);
+        for (size_t i = 0; i < count; ++i) {
+            fill.push_back(center);
+            fill.push_back(points[i]);
+            fill.push_back(points[(i + 1) % count]);
+        }
+
+        if (outlineThickness == 0.0f) {
+            return;
+        }
+        // Outer corner of each point: the average of its two edge normals,
+        // scaled so both edges end up exactly outlineThickness away
+        std::vector<sf::Vector2f> outer(count);
+        for (size_t i = 0; i < count; ++i) {
+            const sf::Vector2f& previous = points[(i + count - 1) % count];
+            const sf::Vector2f& point = points[i];
+            const sf::Vector2f& next = points[(i + 1) % count];
+            sf::Vector2f n1 = outwardNormal(previous, point, center - point);
+            sf::Vector2f n2 = outwardNormal(point, next, center - point);
+            float factor = 1.0f + (n1.x * n2.x + n1.y * n2.y);
+            outer[i] = point + (n1 + n2) * (outlineThickness / factor);
+        }
+        outline.reserve(count * 2 * VERTICES_PER_TRIANGLE);
+        for (size_t i = 0; i < count; ++i) {
+            size_t j = (i + 1) % count;
+            outline.insert(outline.end(), {points[i], outer[i], points[j], outer[i], points[j], outer[j]});
+        }
+    }
+
+    /**
+     * @brief Append a triangle list in one color
+     */
+    void append(const std::vector<sf::Vector2f>& triangles, const sf::Color& color) {
+        for (const auto& position : triangles) {
+            m_vertices.append(sf::Vertex(position, color));
+        }
+    }
+
+    /**
+     * @brief Append a triangle list in one color, moved by transform
+     */
+    void append(const std::vector<sf::Vector2f>& triangles, const sf::Color& color,
+                const sf::Transform& transform) {
+        for (const auto& position : triangles) {
+            m_vertices.append(sf::Vertex(transform.transformPoint(position), color));
+        }
+    }
+
+    /**
+     * @brief Remove all triangles, keeping the allocation for the next frame
+     */
+    void clear() { m_vertices.clear(); }
+
+    bool empty() const { return m_vertices.getVertexCount() == 0; }
+    size_t triangleCount() const { return m_vertices.getVertexCount() / VERTICES_PER_TRIANGLE; }
+    const sf::VertexArray& vertices() const { return m_vertices; }
+
+private:
+    sf::VertexArray m_vertices;
+
+    // Unit normal of edge a->b, flipped to point away from toCenter
+    static sf::Vector2f outwardNormal(const sf::Vector2f& a, const sf::Vector2f& b,
+                                      const sf::Vector2f& toCenter) {
+        sf::Vector2f normal(a.y - b.y, b.x - a.x);
+        float length = std::sqrt(normal.x * normal.x + normal.y * normal.y);
+        if (length != 0.0f) {
+            normal /= length;
+        }
+        if (normal.x * toCenter.x + normal.y * toCenter.y > 0.0f) {
+            normal = -normal;
+        }
+        return normal;
+    }
+};
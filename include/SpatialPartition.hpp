@@ -16,6 +16,8 @@
  * Compatible with existing CAABB component from Component.h
  */
 
+class JobSystem;
+
 // Type aliases for clarity
 using EntityID = size_t;
 using CollisionPair = std::pair<EntityID, EntityID>;
@@ -185,6 +187,29 @@ public:
      */
     virtual std::vector<CollisionPair> findCollisions() const = 0;
     
+    /**
+     * Buffer-reusing variant of query()
+     * @param region World-space CAABB to query
+     * @param out Replaced with the matching entity IDs; its capacity is reused
+     * 
+     * Strategies override this to avoid per-call heap allocations; the
+     * default forwards to query(region).
+     */
+    virtual void query(const CAABB& region, std::vector<EntityID>& out) const {
+        out = query(region);
+    }
+    
+    /**
+     * Buffer-reusing variant of findCollisions()
+     * @param out Replaced with the potential collision pairs; its capacity is reused
+     * 
+     * Keep one buffer per caller across frames so steady-state broadphase
+     * does not allocate (UniformGrid allocates nothing once capacity is reached).
+     */
+    virtual void findCollisions(std::vector<CollisionPair>& out) const {
+        out = findCollisions();
+    }
+    
     /**
      * Find all entities near a specific point
      * @param point World-space point
@@ -209,6 +234,21 @@ public:
      */
     virtual const char* getStrategyName() const = 0;
     
+    /**
+     * Check if the strategy only covers its worldMin/worldMax
+     * Unbounded strategies keep entities anywhere, so callers need not cull them
+     */
+    virtual bool hasFixedBounds() const { return true; }
+    
+    /**
+     * Let findCollisions() split its work across a worker pool
+     * @param jobs Pool to use (must outlive the strategy), or nullptr for single-threaded
+     * 
+     * Output, including pair order, is identical to the single-threaded
+     * path. Strategies without a parallel path ignore this.
+     */
+    virtual void setJobSystem(JobSystem* jobs) { (void)jobs; }
+    
     /**
      * Check if the spatial structure is in a valid state
      * Used for debugging and unit tests
@@ -221,10 +261,12 @@ public:
  * Makes it easy to switch between different implementations
  */
 enum class PartitionType {
-    UNIFORM_GRID,    // Simple grid-based partitioning - IMPLEMENTED
-    QUADTREE,        // Adaptive 2D tree - TODO: Future implementation
-    OCTREE,          // Adaptive 3D tree - TODO: Future implementation  
-    SPATIAL_HASH     // Hash-based infinite partitioning - TODO: Future implementation
+    UNIFORM_GRID,      // Simple grid-based partitioning - IMPLEMENTED
+    QUADTREE,          // Adaptive loose 2D tree (XY plane) - IMPLEMENTED
+    OCTREE,            // Adaptive 3D tree - TODO: Future implementation  
+    SPATIAL_HASH,      // Hash-based unbounded partitioning - IMPLEMENTED
+    SWEEP_AND_PRUNE,   // Sorted endpoints on one axis, incremental - IMPLEMENTED
+    DYNAMIC_AABB_TREE  // BVH with fat leaf bounds, mixed object sizes - IMPLEMENTED
 };
 
 /**
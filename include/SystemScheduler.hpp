@@ -0,0 +1,170 @@
+#pragma once
+
+#include "ComponentTypes.hpp"
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+class JobCounter;
+class JobSystem;
+
+/**
+ * SystemAccess - What a system touches, declared up front
+ *
+ * Components are declared by type; data handed between systems outside
+ * the component store (e.g. the collision event list) is declared as a
+ * named resource. Writing implies reading. A system that cannot declare
+ * its access (structural changes, legacy code) is marked exclusive and
+ * is ordered against every other system.
+ *
+ * Usage:
+ *   SystemAccess().reads<CAABB>().writes<CTransform3D, CMovement3D>()
+ *                 .readsResource("collisions")
+ */
+class SystemAccess {
+public:
+    template <typename... Components>
+    SystemAccess& reads() {
+        (addComponent<Components>(m_reads, m_readNames), ...);
+        return *this;
+    }
+
+    template <typename... Components>
+    SystemAccess& writes() {
+        (addComponent<Components>(m_writes, m_writeNames), ...);
+        return *this;
+    }
+
+    SystemAccess& readsResource(const std::string& name);
+    SystemAccess& writesResource(const std::string& name);
+    SystemAccess& exclusive();
+
+    /**
+     * @brief True if the two systems cannot run at the same time
+     */
+    bool conflictsWith(const SystemAccess& other) const;
+
+    /**
+     * @brief Human-readable summary, e.g. "reads CAABB; writes CTransform3D"
+     */
+    std::string describe() const;
+
+private:
+    template <typename T>
+    void addComponent(ComponentMask& mask, std::vector<std::string>& names) {
+        size_t id = ComponentTypeIDGenerator::getID<T>();
+        if (!mask.test(id)) {
+            mask.set(id);
+            names.push_back(typeName(typeid(T)));
+        }
+    }
+
+    // Readable class name; typeid names are mangled under GCC/Clang
+    static std::string typeName(const std::type_info& type);
+
+    ComponentMask m_reads;
+    ComponentMask m_writes;
+    std::vector<std::string> m_readNames; // Parallel to the mask bits, for describe()
+    std::vector<std::string> m_writeNames;
+    std::vector<std::string> m_readResources;
+    std::vector<std::string> m_writeResources;
+    bool m_exclusive = false;
+};
+
+/**
+ * SystemScheduler - Runs per-frame systems as a dependency graph
+ *
+ * Systems are registered in their serial order with the access they
+ * declare. Whenever the system list changes, the scheduler builds a DAG:
+ * a later system depends on an earlier one if their accesses conflict
+ * (one writes what the other reads or writes). Edges implied by others
+ * are dropped, so the graph is a transitive reduction.
+ *
+ * run() executes the DAG on the job system: a system is submitted as
+ * soon as its last dependency finishes, so non-conflicting systems run
+ * concurrently. Without a job system (or with no workers) systems run
+ * in registration order, which is a valid order of the same DAG, so
+ * results do not depend on which path ran.
+ *
+ * Systems may use the same job system internally (nested parallelFor).
+ * Component types touched by concurrently running systems must already
+ * be registered with the ComponentManager; first-use registration is
+ * not thread-safe. getScheduleDump() reports levels, edges and last-frame
+ * timings for profiling.
+ */
+class SystemScheduler {
+public:
+    using SystemFn = std::function<void(float deltaTime)>;
+
+    /**
+     * Per-system profile from the last run()
+     */
+    struct SystemStats {
+        std::string name;
+        size_t level = 0;         // Longest dependency chain before this system
+        double lastMs = 0.0;      // Wall time of the last run
+        double lastStartMs = 0.0; // Start offset within the last frame
+        size_t lastThread = 0;    // JobSystem thread index it ran on
+    };
+
+    SystemScheduler();
+    ~SystemScheduler();
+
+    SystemScheduler(const SystemScheduler&) = delete;
+    SystemScheduler& operator=(const SystemScheduler&) = delete;
+
+    /**
+     * @brief Run systems on jobs (nullptr = registration order on the caller)
+     */
+    void setJobSystem(JobSystem* jobs) { m_jobs = jobs; }
+
+    /**
+     * @brief Append a system; its position is the tie-break order for conflicts
+     * @return Index of the system, as used by getDependencies()/getStats()
+     */
+    size_t addSystem(const std::string& name, const SystemAccess& access, SystemFn fn);
+
+    /**
+     * @brief Run every system once for this frame and wait for all of them
+     */
+    void run(float deltaTime);
+
+    size_t getSystemCount() const { return m_systems.size(); }
+
+    /**
+     * @brief Direct predecessors of a system after transitive reduction
+     */
+    const std::vector<size_t>& getDependencies(size_t system);
+
+    /**
+     * @brief Profile of a system (level is valid once the graph is built)
+     */
+    const SystemStats& getStats(size_t system);
+
+    /**
+     * @brief Duration of the last run() in milliseconds
+     */
+    double getLastFrameMs() const { return m_lastFrameMs; }
+
+    /**
+     * @brief Multi-line dump: one line per system with level, thread,
+     * timing, dependencies and declared access
+     */
+    std::string getScheduleDump();
+
+private:
+    struct Node;
+
+    void buildGraph();
+    void runNode(size_t index, float deltaTime);
+    void submitNode(size_t index, float deltaTime, JobCounter& frame);
+
+    std::vector<std::unique_ptr<Node>> m_systems;
+    JobSystem* m_jobs = nullptr;
+    bool m_graphDirty = true;
+    double m_lastFrameMs = 0.0;
+    double m_frameStart = 0.0; // steady_clock milliseconds at the start of run()
+};
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "Component.h"
+#include "EntityManager.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <glm/glm.hpp>
+
+/**
+ * TransformInterpolator - Blends rendered transforms between simulation ticks
+ *
+ * With a fixed timestep the latest simulation state is up to one tick
+ * ahead of the render frame. capture() snapshots every CTransform3D's
+ * position and rotation just before a tick; the renderer then draws
+ * mix(snapshot, current, alpha), with alpha from FixedTimestep::getAlpha().
+ *
+ * Snapshots live in dense arrays indexed by entity ID. An entity that had
+ * no CTransform3D at the last capture (spawned since) renders at its
+ * current transform. Scale is not interpolated.
+ *
+ * IDs are recycled, so capture() also subscribes to the EntityManager and
+ * drops an entity's snapshot when it is removed; an entity that takes the
+ * slot before the next capture renders at its own current transform.
+ */
+class TransformInterpolator {
+public:
+    TransformInterpolator() = default;
+    // The removal listener points back at this object
+    TransformInterpolator(const TransformInterpolator&) = delete;
+    TransformInterpolator& operator=(const TransformInterpolator&) = delete;
+
+    /**
+     * @brief Snapshot every CTransform3D as the "previous" state (call before each tick)
+     */
+    void capture(EntityManager& entityManager);
+
+    /**
+     * @brief Blend factor toward the current state; 1 renders the latest tick unchanged
+     */
+    void setAlpha(float alpha) { m_alpha = alpha; }
+    float getAlpha() const { return m_alpha; }
+
+    /**
+     * @brief Forget all snapshots (render current transforms until the next capture)
+     */
+    void clear();
+
+    glm::vec3 position(size_t entityID, const CTransform3D& current) const {
+        if (!hasSnapshot(entityID)) {
+            return current.position;
+        }
+        return glm::mix(m_positions[entityID], current.position, m_alpha);
+    }
+
+    glm::vec3 rotation(size_t entityID, const CTransform3D& current) const {
+        if (!hasSnapshot(entityID)) {
+            return current.rotation;
+        }
+        return glm::mix(m_rotations[entityID], current.rotation, m_alpha);
+    }
+
+    /**
+     * @brief True if position() and rotation() would return the current transform
+     *
+     * Entities that did not move during the last tick render exactly where
+     * they are, so their cached CModelMatrix can be drawn as is.
+     */
+    bool rendersCurrent(size_t entityID, const CTransform3D& current) const {
+        return !hasSnapshot(entityID) ||
+               (m_positions[entityID] == current.position && m_rotations[entityID] == current.rotation);
+    }
+
+private:
+    // Forwards removals to forget(); held weakly by the EntityManager
+    class RemovalListener : public EntityListener {
+    public:
+        RemovalListener(TransformInterpolator& owner, const EntityManager& entityManager)
+            : m_owner(owner), m_entityManager(&entityManager) {}
+        bool isAttachedTo(const EntityManager& entityManager) const {
+            return m_entityManager == &entityManager && entityManager.hasListener(this);
+        }
+        void onEntityAdded(Entity&) override {}
+        void onEntityRemoved(Entity& entity) override { m_owner.forget(entity.id()); }
+
+    private:
+        TransformInterpolator& m_owner;
+        const EntityManager* m_entityManager;
+    };
+
+    void forget(size_t entityID) {
+        if (entityID < m_captureStamps.size()) {
+            m_captureStamps[entityID] = 0;
+        }
+    }
+
+    bool hasSnapshot(size_t entityID) const {
+        return m_alpha < 1.0f && entityID < m_captureStamps.size() && m_captureStamps[entityID] == m_stamp;
+    }
+
+    std::vector<glm::vec3> m_positions;
+    std::vector<glm::vec3> m_rotations;
+    std::vector<uint32_t> m_captureStamps; // m_stamp when the entity was last captured
+    uint32_t m_stamp = 0;                  // Bumped per capture; 0 = never captured
+    float m_alpha = 1.0f;
+    std::shared_ptr<RemovalListener> m_listener;
+};
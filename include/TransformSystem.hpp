@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Component.h"
+#include "EntityManager.h"
+#include "JobSystem.hpp"
+#include <glm/glm.hpp>
+#include <vector>
+
+/**
+ * TransformSystem - Keeps CModelMatrix in step with CTransform3D
+ *
+ * Systems that write a CTransform3D (movement, collision resolution,
+ * boundaries) set its dirty flag; updateModelMatrices() rebuilds the
+ * cached matrix of dirty entities only and clears the flag. Static
+ * entities cost one flag test per pass.
+ *
+ * Code that writes a transform outside those systems must set
+ * CTransform3D::dirty itself, or the renderer keeps the old matrix.
+ */
+class TransformSystem {
+public:
+    /**
+     * @brief Rebuild CModelMatrix for every entity whose CTransform3D is dirty
+     * @return Number of matrices rebuilt
+     *
+     * Runs across the job system if one is set; each entity touches only
+     * its own components.
+     */
+    size_t updateModelMatrices(EntityManager& entityManager);
+
+    /**
+     * @brief Run the pass data-parallel on jobs (nullptr = calling thread only)
+     */
+    void setJobSystem(JobSystem* jobs) { m_jobs = jobs; }
+
+    /**
+     * @brief Model matrix for a transform: translate * rotX * rotY * rotZ * scale
+     * @param rotation Euler angles in degrees
+     *
+     * Closed form of the glm::translate/rotate/scale chain, without the
+     * three 4x4 multiplies.
+     */
+    static glm::mat4 modelMatrix(const glm::vec3& position, const glm::vec3& rotation,
+                                 const glm::vec3& scale);
+
+private:
+    JobSystem* m_jobs = nullptr;
+    std::vector<size_t> m_threadRebuilt; // Matrices rebuilt by each job-system thread
+};
@@ -1,6 +1,7 @@
 #include "../include/BoundarySystem.hpp"
 #include "../include/Logger.hpp"
 #include "../include/Constants.hpp"
+#include <algorithm>
 
 BoundarySystem::BoundarySystem(const BoundaryConstraint& constraint) 
     : m_globalConstraint(constraint) {
@@ -9,15 +10,41 @@ BoundarySystem::BoundarySystem(const BoundaryConstraint& constraint)
 void BoundarySystem::enforceBoundaries(EntityManager& entityManager) {
     m_entitiesToDestroy.clear();
     
-    for (auto& entity : entityManager.getEntities()) {
-        if (!entity->has<CTransform3D>()) {
-            continue;
+    // Bounds test runs straight off the transform array; the Entity is only
+    // looked up for the (rare) entities that actually violate a boundary
+    m_violations.clear();
+    auto view = entityManager.view<CTransform3D>();
+    if (m_jobs) {
+        m_threadViolations.resize(m_jobs->getThreadCount());
+        for (auto& found : m_threadViolations) {
+            found.clear();
         }
-        
-        if (isEntityOutOfBounds(entity)) {
-            glm::vec3 violations = getViolatedBoundaries(entity);
-            handleBoundaryViolation(entity, violations);
+        view.parallelEach(*m_jobs, [&](size_t entityID, CTransform3D& transform) {
+            if (isPositionOutOfBounds(transform.position)) {
+                m_threadViolations[m_jobs->getCurrentThreadIndex()].push_back(entityID);
+            }
+        });
+        for (const auto& found : m_threadViolations) {
+            m_violations.insert(m_violations.end(), found.begin(), found.end());
+        }
+        // Threads finish in any order; sort so handling (and destruction) is reproducible
+        std::sort(m_violations.begin(), m_violations.end());
+    } else {
+        view.each([&](size_t entityID, CTransform3D& transform) {
+            if (isPositionOutOfBounds(transform.position)) {
+                m_violations.push_back(entityID);
+            }
+        });
+    }
+    
+    for (size_t entityID : m_violations) {
+        auto entity = entityManager.getEntityById(entityID);
+        if (!entity) {
+            continue; // Pending addition - not simulated until EntityManager::update()
         }
+        
+        glm::vec3 violations = getViolatedBoundaries(entity);
+        handleBoundaryViolation(entity, violations);
     }
     
     // Destroy entities marked for destruction
@@ -46,8 +73,10 @@ bool BoundarySystem::isEntityOutOfBounds(std::shared_ptr<Entity> entity) const {
         return false;
     }
     
-    const auto& position = entity->get<CTransform3D>().position;
-    
+    return isPositionOutOfBounds(entity->get<CTransform3D>().position);
+}
+
+bool BoundarySystem::isPositionOutOfBounds(const glm::vec3& position) const {
     return position.x < m_globalConstraint.minBounds.x || position.x > m_globalConstraint.maxBounds.x ||
            position.y < m_globalConstraint.minBounds.y || position.y > m_globalConstraint.maxBounds.y ||
            position.z < m_globalConstraint.minBounds.z || position.z > m_globalConstraint.maxBounds.z;
@@ -105,6 +134,7 @@ void BoundarySystem::handleBoundaryViolation(std::shared_ptr<Entity> entity, con
 
 void BoundarySystem::applyBounceAction(std::shared_ptr<Entity> entity, const glm::vec3& violations, float damping) {
     auto& transform = entity->get<CTransform3D>();
+    transform.dirty = true;
     
     // Clamp position to boundaries
     if (violations.x > 0) {
@@ -143,6 +173,7 @@ void BoundarySystem::applyBounceAction(std::shared_ptr<Entity> entity, const glm
 
 void BoundarySystem::applyWrapAction(std::shared_ptr<Entity> entity, const glm::vec3& violations) {
     auto& transform = entity->get<CTransform3D>();
+    transform.dirty = true;
     
     // Teleport to opposite side
     if (violations.x > 0) {
@@ -166,6 +197,7 @@ void BoundarySystem::applyWrapAction(std::shared_ptr<Entity> entity, const glm::
 
 void BoundarySystem::applyClampAction(std::shared_ptr<Entity> entity, const glm::vec3& violations) {
     auto& transform = entity->get<CTransform3D>();
+    transform.dirty = true;
     
     // Clamp position to boundaries
     transform.position.x = glm::clamp(transform.position.x, 
@@ -2,44 +2,49 @@
 #include "../include/Logger.hpp"
 #include <algorithm>
 
+CollisionDetectionSystem::CollisionDetectionSystem(PartitionType type,
+                                                   const glm::vec3& worldMin,
+                                                   const glm::vec3& worldMax,
+                                                   float cellSize)
+    : m_broadphase(createSpatialPartition(type, worldMin, worldMax, cellSize)) {}
+
 std::vector<CollisionEvent> CollisionDetectionSystem::detectCollisions(EntityManager& entityManager) {
     std::vector<CollisionEvent> collisions;
-    auto entities = entityManager.getEntities();
     
-    // Update AABB for all entities first
-    for (auto& entity : entities) {
-        if (entity->has<CAABB>() && entity->has<CTransform3D>()) {
-            updateAABBForEntity(entity);
-        }
+    // Switching managers restarts registration from scratch
+    if (!m_sync || !m_sync->isAttachedTo(entityManager)) {
+        m_sync = PartitionSync::attach(*m_broadphase, entityManager);
     }
     
-    // O(N²) collision detection - can be optimized with spatial partitioning later
-    for (size_t i = 0; i < entities.size(); ++i) {
-        for (size_t j = i + 1; j < entities.size(); ++j) {
-            auto entityA = entities[i];
-            auto entityB = entities[j];
-            
-            // Only check entities with collision components
-            if (!entityA->has<CAABB>() || !entityB->has<CAABB>()) {
-                continue;
-            }
-            
-            // Skip if either entity doesn't have transform
-            if (!entityA->has<CTransform3D>() || !entityB->has<CTransform3D>()) {
-                continue;
-            }
-            
-            CAABB aabbA = entityA->get<CAABB>();
-            CAABB aabbB = entityB->get<CAABB>();
-            
-            if (checkAABBCollision(aabbA, aabbB)) {
-                CollisionEvent collision = calculateCollisionDetails(entityA, entityB);
-                collisions.push_back(collision);
-                
-                LOG_DEBUG_STREAM("CollisionDetectionSystem: Collision detected between entities " 
-                                << entityA->id() << " and " << entityB->id());
-            }
+    // Update AABBs; only entities whose bounds changed touch the broadphase
+    m_sync->sync(entityManager,
+        [](const CTransform3D& transform, CAABB& aabb, CAABB& worldBounds) {
+            updateAABB(transform, aabb);
+            worldBounds = aabb;
+            return true;
+        });
+    
+    // Broadphase already filtered pairs by AABB overlap
+    m_broadphase->findCollisions(m_pairs);
+    for (auto& pair : m_pairs) {
+        if (pair.first > pair.second) {
+            std::swap(pair.first, pair.second);
+        }
+    }
+    std::sort(m_pairs.begin(), m_pairs.end());
+    
+    collisions.reserve(m_pairs.size());
+    for (const auto& pair : m_pairs) {
+        std::shared_ptr<Entity> entityA = entityManager.getEntityById(pair.first);
+        std::shared_ptr<Entity> entityB = entityManager.getEntityById(pair.second);
+        if (!entityA || !entityB) {
+            continue;
         }
+        
+        collisions.push_back(calculateCollisionDetails(entityA, entityB));
+        
+        LOG_DEBUG_STREAM("CollisionDetectionSystem: Collision detected between entities " 
+                        << entityA->id() << " and " << entityB->id());
     }
     
     LOG_DEBUG_STREAM("CollisionDetectionSystem: Detected " << collisions.size() << " collisions");
@@ -52,7 +57,7 @@ bool CollisionDetectionSystem::checkAABBCollision(const CAABB& a, const CAABB& b
            (a.max.z > b.min.z && a.min.z < b.max.z);
 }
 
-CollisionEvent CollisionDetectionSystem::calculateCollisionDetails(std::shared_ptr<Entity> entityA, std::shared_ptr<Entity> entityB) {
+CollisionEvent CollisionDetectionSystem::calculateCollisionDetails(const std::shared_ptr<Entity>& entityA, const std::shared_ptr<Entity>& entityB) {
     CollisionEvent collision(entityA, entityB);
     
     const CAABB& aabbA = entityA->get<CAABB>();
@@ -65,26 +70,27 @@ CollisionEvent CollisionDetectionSystem::calculateCollisionDetails(std::shared_p
     return collision;
 }
 
-void CollisionDetectionSystem::updateAABBForEntity(std::shared_ptr<Entity> entity) {
+void CollisionDetectionSystem::updateAABBForEntity(const std::shared_ptr<Entity>& entity) {
     if (!entity->has<CTransform3D>() || !entity->has<CAABB>()) {
         return;
     }
     
+    updateAABB(entity->get<CTransform3D>(), entity->get<CAABB>());
+}
+
+void CollisionDetectionSystem::updateAABB(const CTransform3D& transform, CAABB& aabb) {
     // For now, we'll assume CAABB components are updated externally
     // In a more complete system, we'd calculate AABB from CTriangle vertices here
-    const auto& transform = entity->get<CTransform3D>();
-    auto& aabb = entity->get<CAABB>();
     
     // Simple approach: translate the AABB to the entity's position
     // This assumes the CAABB was created relative to origin
-    glm::vec3 center = (aabb.min + aabb.max) * 0.5f;
     glm::vec3 extents = (aabb.max - aabb.min) * 0.5f;
     
     aabb.min = transform.position - extents;
     aabb.max = transform.position + extents;
 }
 
-CAABB CollisionDetectionSystem::getWorldAABB(std::shared_ptr<Entity> entity) {
+CAABB CollisionDetectionSystem::getWorldAABB(const std::shared_ptr<Entity>& entity) {
     if (!entity->has<CTransform3D>() || !entity->has<CAABB>()) {
         return CAABB(); // Return default AABB
     }
@@ -77,6 +77,8 @@ void CollisionResolutionSystem::separateEntities(const CollisionEvent& collision
     
     transformA.position -= separation;
     transformB.position += separation;
+    transformA.dirty = true;
+    transformB.dirty = true;
 }
 
 void CollisionResolutionSystem::applyElasticResponse(const CollisionEvent& collision, const CollisionResponse& response) {
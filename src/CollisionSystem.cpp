@@ -21,24 +21,23 @@ CollisionSystem::CollisionSystem(PartitionType type,
 void CollisionSystem::updateEntities(EntityManager& entityManager) {
     if (!m_spatialPartition) return;
     
-    // Clear previous frame's data
-    m_spatialPartition->clear();
+    // Start over when bound to a different manager (or after clear())
+    if (!m_sync || !m_sync->isAttachedTo(entityManager)) {
+        m_sync = PartitionSync::attach(*m_spatialPartition, entityManager);
+    }
     
-    // Add all entities with collision components to spatial partition
-    for (auto& entity : entityManager.getEntities()) {
-        if (entity->has<CAABB>() && entity->has<CTransform3D>()) {
-            CAABB worldAABB = AABBUtils::getWorldAABB(entity);
+    m_sync->sync(entityManager,
+        [this](const CTransform3D& transform, const CAABB& localAABB, CAABB& worldAABB) {
+            worldAABB.min = localAABB.min + transform.position;
+            worldAABB.max = localAABB.max + transform.position;
             
-            // Only add entities that are within world bounds
+            // Bounded strategies only take entities within world bounds
             // This prevents issues with entities far outside the grid
-            if (worldAABB.min.x >= m_worldMin.x && worldAABB.max.x <= m_worldMax.x &&
-                worldAABB.min.y >= m_worldMin.y && worldAABB.max.y <= m_worldMax.y &&
-                worldAABB.min.z >= m_worldMin.z && worldAABB.max.z <= m_worldMax.z) {
-                
-                m_spatialPartition->insert(entity->id(), worldAABB);
-            }
-        }
-    }
+            return !m_spatialPartition->hasFixedBounds() ||
+                (worldAABB.min.x >= m_worldMin.x && worldAABB.max.x <= m_worldMax.x &&
+                 worldAABB.min.y >= m_worldMin.y && worldAABB.max.y <= m_worldMax.y &&
+                 worldAABB.min.z >= m_worldMin.z && worldAABB.max.z <= m_worldMax.z);
+        });
 }
 
 std::vector<CollisionPair> CollisionSystem::findCollisions() {
@@ -49,6 +48,15 @@ std::vector<CollisionPair> CollisionSystem::findCollisions() {
     return m_spatialPartition->findCollisions();
 }
 
+void CollisionSystem::findCollisions(std::vector<CollisionPair>& out) {
+    if (!m_spatialPartition) {
+        out.clear();
+        return;
+    }
+    
+    m_spatialPartition->findCollisions(out);
+}
+
 std::vector<std::shared_ptr<Entity>> CollisionSystem::findCollisionsFor(
     const std::shared_ptr<Entity>& entity, EntityManager& entityManager) {
     
@@ -133,6 +141,7 @@ PartitionStats CollisionSystem::getStatistics() const {
 }
 
 void CollisionSystem::clear() {
+    m_sync.reset();
     if (m_spatialPartition) {
         m_spatialPartition->clear();
     }
@@ -1,4 +1,5 @@
 #include "../include/Component.h"
+#include "../include/ShapeBatch.hpp"
 #include <limits>
 #include <cmath>
 #include <string>
@@ -12,6 +13,8 @@ CTransform3D::CTransform3D(const glm::vec3 &position, const glm::vec3 &rotation,
                            const glm::vec3 &scale)
     : position(position), rotation(rotation), scale(scale){};
 
+CModelMatrix::CModelMatrix() = default;
+
 CShape::CShape() = default;
 CShape::CShape(float radius, size_t points, const sf::Color &fill,
                const sf::Color &outline, float thickness)
@@ -194,3 +197,15 @@ CComplexShape::CComplexShape()
 CComplexShape::CComplexShape(const std::vector<Vec2f>& verts, sf::Color fill, sf::Color outline, float thickness)
     : type(POLYGON), vertices(verts), fillColor(fill), outlineColor(outline), 
       outlineThickness(thickness), showVertices(false) {};
+
+bool CComplexShape::updateTriangulation() {
+  if (!fillTriangles.empty() && triangulatedVertices == vertices &&
+      triangulatedThickness == outlineThickness) {
+    return false;
+  }
+  ShapeBatch::triangulate(vertices, outlineThickness, fillTriangles,
+                          outlineTriangles);
+  triangulatedVertices = vertices;
+  triangulatedThickness = outlineThickness;
+  return true;
+}
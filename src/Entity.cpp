@@ -4,6 +4,9 @@
 std::unique_ptr<ComponentManager> Entity::s_componentManager = nullptr;
 
 size_t Entity::id() const { return m_id; };
+EntityHandle Entity::handle() const {
+  return EntityHandle(static_cast<uint32_t>(m_id), m_generation);
+};
 bool Entity::isActive() const { return m_active; };
 void Entity::destroy() { m_active = false; };
 const EntityTag &Entity::tag() const { return m_tag; };
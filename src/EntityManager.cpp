@@ -14,41 +14,111 @@ typedef std::map<EntityTag, EntityVec> EntityMap;
 std::shared_ptr<Entity> EntityManager::addEntity(const EntityTag &tag) {
   // Helper struct to access private constructor with make_shared
   struct EntityBuilder : public Entity {
-    EntityBuilder(size_t id, const EntityTag &tag) : Entity(id, tag) {}
+    EntityBuilder(size_t id, const EntityTag &tag, uint32_t generation)
+        : Entity(id, tag, generation) {}
   };
 
-  auto e = std::make_shared<EntityBuilder>(m_totalEntities++, tag);
+  // Reuse a freed slot if available, otherwise grow the slot table
+  uint32_t index;
+  if (!m_freeSlots.empty()) {
+    index = m_freeSlots.back();
+    m_freeSlots.pop_back();
+  } else {
+    index = static_cast<uint32_t>(m_slots.size());
+    m_slots.emplace_back();
+  }
+
+  EntitySlot &slot = m_slots[index];
+  auto e = std::make_shared<EntityBuilder>(index, tag, slot.generation);
+  slot.entity = e;
   m_toAdd.push_back(e); // delay for iterator invalidation
   return e;
 };
 
+void EntityManager::releaseSlot(size_t id) {
+  EntitySlot &slot = m_slots[id];
+  slot.entity.reset();
+  slot.added = false;
+  slot.generation++; // invalidates all outstanding handles to this slot
+  m_freeSlots.push_back(static_cast<uint32_t>(id));
+}
+
+template <typename Fn> void EntityManager::notifyListeners(Fn &&fn) {
+  if (m_listeners.empty()) {
+    return;
+  }
+  auto expired = std::remove_if(
+      m_listeners.begin(), m_listeners.end(),
+      [](const std::weak_ptr<EntityListener> &l) { return l.expired(); });
+  m_listeners.erase(expired, m_listeners.end());
+  for (auto &weakListener : m_listeners) {
+    if (auto listener = weakListener.lock()) {
+      fn(*listener);
+    }
+  }
+}
+
+void EntityManager::addListener(
+    const std::shared_ptr<EntityListener> &listener) {
+  m_listeners.push_back(listener);
+}
+
+bool EntityManager::hasListener(const EntityListener *listener) const {
+  for (const auto &weakListener : m_listeners) {
+    auto l = weakListener.lock();
+    if (l && l.get() == listener) {
+      return true;
+    }
+  }
+  return false;
+}
+
 void EntityManager::update() {
+  bool changed = !m_toAdd.empty();
 
-  for (auto e : m_toAdd) {
+  for (auto &e : m_toAdd) {
     m_entities.push_back(e);
     m_entityMap[e->tag()].push_back(e);
+    m_slots[e->id()].added = true;
+    notifyListeners([&](EntityListener &l) { l.onEntityAdded(*e); });
   }
+  m_toAdd.clear();
+
+  // Remove inactive entities from each tag group
+  for (auto &pair : m_entityMap) {
+    auto &taggedEntities = pair.second;
+    auto tagIt = std::remove_if(
+        taggedEntities.begin(), taggedEntities.end(),
+        [](const std::shared_ptr<Entity> &e) { return !e->isActive(); });
+    taggedEntities.erase(tagIt, taggedEntities.end());
+  }
+
   // Remove inactive entities from main vector
   auto it = std::remove_if(m_entities.begin(), m_entities.end(),
-                           [](const std::shared_ptr<Entity> &e) {
+                           [this](const std::shared_ptr<Entity> &e) {
                              if (!e->isActive()) {
+                               notifyListeners([&](EntityListener &l) {
+                                 l.onEntityRemoved(*e);
+                               });
                                // Clean up entity's components before removing
                                e->removeAllComponents();
+                               releaseSlot(e->id());
                                return true;
                              }
                              return false;
                            });
+  if (it != m_entities.end()) {
+    changed = true;
+  }
   m_entities.erase(it, m_entities.end());
 
-  // Remove inactive entities from each tag group
-  for (auto &pair : m_entityMap) {
-    auto &taggedEntities = pair.second;
-    auto tagIt = std::remove_if(
-        taggedEntities.begin(), taggedEntities.end(),
-        [](const std::shared_ptr<Entity> &e) { return !e->isActive(); });
-    taggedEntities.erase(tagIt, taggedEntities.end());
+  if (changed) {
+    m_handles.clear();
+    m_handles.reserve(m_entities.size());
+    for (const auto &e : m_entities) {
+      m_handles.push_back(e->handle());
+    }
   }
-  m_toAdd.clear();
 };
 
 EntityVec &EntityManager::getEntities() { return m_entities; }
@@ -69,15 +139,10 @@ const EntityVec &EntityManager::getEntities(const EntityTag &tag) const {
 }
 
 std::shared_ptr<Entity> EntityManager::getEntityById(size_t id) const {
-  auto it = std::find_if(
-      m_entities.begin(), m_entities.end(),
-      [id](const std::shared_ptr<Entity> &e) { return e->id() == id; });
-
-  if (it != m_entities.end()) {
-    return *it;
+  if (id >= m_slots.size() || !m_slots[id].added) {
+    return nullptr;
   }
-
-  return nullptr;
+  return m_slots[id].entity;
 }
 
 std::shared_ptr<Entity> EntityManager::getEntityById(size_t id) {
@@ -85,15 +150,52 @@ std::shared_ptr<Entity> EntityManager::getEntityById(size_t id) {
   return const_cast<const EntityManager *>(this)->getEntityById(id);
 }
 
+const std::vector<EntityHandle> &EntityManager::getHandles() const {
+  return m_handles;
+}
+
+bool EntityManager::isValid(const EntityHandle &handle) const {
+  return handle.index < m_slots.size() &&
+         m_slots[handle.index].generation == handle.generation &&
+         m_slots[handle.index].entity != nullptr;
+}
+
+const Entity *EntityManager::getEntity(const EntityHandle &handle) const {
+  return isValid(handle) ? m_slots[handle.index].entity.get() : nullptr;
+}
+
+Entity *EntityManager::getEntity(const EntityHandle &handle) {
+  return isValid(handle) ? m_slots[handle.index].entity.get() : nullptr;
+}
+
 bool EntityManager::hasTag(const EntityTag &tag) const {
   return m_entityMap.find(tag) != m_entityMap.end();
 }
 
 void EntityManager::clear() {
+  for (auto &e : m_entities) {
+    notifyListeners([&](EntityListener &l) { l.onEntityRemoved(*e); });
+  }
+
+  // Component storage is wiped below; drop each entity's mask so a handle
+  // holder's late destructor can't strip components from a reused ID
+  for (auto &e : m_entities) {
+    e->m_componentMask.reset();
+  }
+  for (auto &e : m_toAdd) {
+    e->m_componentMask.reset();
+  }
+
   m_entities.clear();
   m_entityMap.clear();
   m_toAdd.clear();
-  m_totalEntities = 0;
+  m_handles.clear();
+
+  // Keep generations so old handles stay stale, but hand IDs out from 0 again
+  m_freeSlots.clear();
+  for (size_t i = m_slots.size(); i-- > 0;) {
+    releaseSlot(i);
+  }
 
   // Clear component system
   if (Entity::getComponentManager()) {
@@ -26,12 +26,15 @@ Game::Game(const std::string &config) {
   m_sceneManager.registerScene(
       "GameScene", std::function<std::shared_ptr<BaseScene>()>([this]() {
         return std::static_pointer_cast<BaseScene>(
-            std::make_shared<GameScene>(m_window));
+            std::make_shared<GameScene>(m_window, &m_jobSystem));
       }));
   // Use new thread-safe API for initial scene loading
   m_sceneManager.requestSceneTransition("GameScene");
   m_sceneManager.processTransitions(); // Process immediately for startup
   LOG_INFO("Game: Scene initialization complete");
+  LOG_INFO_STREAM("Game: Job system running " << m_jobSystem.getThreadCount() << " threads");
+  LOG_INFO_STREAM("Game: Simulating at " << m_timestep.getTickRate() << " Hz, up to "
+                  << m_timestep.getMaxSubsteps() << " ticks per frame");
 };
 
 void Game::run() {
@@ -66,13 +69,21 @@ void Game::run() {
 
     m_window.clear(sf::Color::Black);
 
+    // Fixed ticks for as much frame time as has accumulated; input, camera
+    // and rendering keep the variable frame delta
+    int ticks = m_timestep.advance(deltaTime);
     if (currentScene && !currentScene->isPaused()) {
-      currentScene->sMovement(deltaTime);
-      // sGravity();
-      // other pausable systems
+      for (int tick = 0; tick < ticks; ++tick) {
+        currentScene->sMovement(m_timestep.getStep());
+        // sGravity();
+        // other pausable systems
+      }
+    } else {
+      m_timestep.reset();
     }
 
     if (currentScene) {
+      currentScene->setRenderInterpolation(m_timestep.getAlpha());
       currentScene->sRender();
       // systems that cannot pause
     }
@@ -10,7 +10,6 @@
 void GameScene::onUnload() {
   LOG_INFO("GameScene: Unloading scene and cleaning up resources");
   m_entityManager.clear();
-  m_collisionSystem->clear();
   m_renderer->onUnload();
   m_renderer.reset();
   m_actionController->unregisterAll();
@@ -22,38 +21,65 @@ void GameScene::onUnload() {
   m_collisionResolutionSystem.reset();
   m_boundarySystem.reset();
   m_movementSystem.reset();
+  m_transformSystem.reset();
 };
 
 void GameScene::update(float deltaTime) { m_entityManager.update(); };
 
 void GameScene::sRender() {
+  // Once per frame rather than per tick: only the latest transforms are drawn
+  m_transformSystem->updateModelMatrices(m_entityManager);
   m_renderer->render(m_entityManager.getEntities());
 };
 
-GameScene::GameScene(sf::RenderWindow &window) : m_window(window) {
+void GameScene::setRenderInterpolation(float alpha) {
+  // Paused: no ticks advance, so show the latest state rather than blending
+  m_interpolator.setAlpha(m_paused ? 1.0f : alpha);
+};
+
+GameScene::GameScene(sf::RenderWindow &window, JobSystem *jobs)
+    : m_window(&window), m_jobs(jobs) {
   m_camera = std::make_shared<Camera>(glm::vec3{
       EngineConstants::Camera::START_X, EngineConstants::Camera::START_Y,
       EngineConstants::Camera::START_Z});
   m_window_size = (Vec2f)window.getSize(); // TODO: handle resize
   m_windowCenter = sf::Vector2i(m_window_size.x / 2, m_window_size.y / 2);
   m_renderer = std::make_unique<OpenGLRenderer>(m_camera, window);
-  m_actionController = std::make_shared<ActionController<SceneActions>>();
+  int gridSize = EngineConstants::World::ENTITY_GRID_SIZE;
+  initSimulation(static_cast<size_t>(gridSize * gridSize * gridSize));
+};
 
-  // Initialize collision system with uniform grid
-  m_collisionSystem = std::make_unique<CollisionSystem>(
-      PartitionType::UNIFORM_GRID,
-      glm::vec3(EngineConstants::World::MIN_BOUND,
-                EngineConstants::World::MIN_BOUND,
-                EngineConstants::World::MIN_BOUND),
-      glm::vec3(EngineConstants::World::MAX_BOUND,
-                EngineConstants::World::MAX_BOUND,
-                EngineConstants::World::MAX_BOUND),
-      EngineConstants::SpatialPartition::DEFAULT_CELL_SIZE);
+GameScene::GameScene(JobSystem *jobs, size_t entityCount)
+    : m_window(nullptr), m_jobs(jobs) {
+  m_camera = std::make_shared<Camera>(glm::vec3{
+      EngineConstants::Camera::START_X, EngineConstants::Camera::START_Y,
+      EngineConstants::Camera::START_Z});
+  m_window_size = Vec2f(EngineConstants::Display::WINDOW_WIDTH,
+                        EngineConstants::Display::WINDOW_HEIGHT);
+  auto renderer = std::make_unique<NullRenderer>();
+  m_headlessRenderer = renderer.get();
+  m_renderer = std::move(renderer);
+  initSimulation(entityCount);
+};
+
+void GameScene::initSimulation(size_t entityCount) {
+  m_renderer->setInterpolator(&m_interpolator);
+  m_actionController = std::make_shared<ActionController<SceneActions>>();
 
   // Initialize new physics systems
-  m_collisionDetectionSystem = std::make_unique<CollisionDetectionSystem>();
+  // Collision broadphase uses a uniform grid covering the world bounds,
+  // with cells sized to the triangles rather than the default 10 units
+  m_collisionDetectionSystem = std::make_unique<CollisionDetectionSystem>(
+      PartitionType::UNIFORM_GRID,
+      glm::vec3(EngineConstants::World::MIN_BOUND),
+      glm::vec3(EngineConstants::World::MAX_BOUND),
+      EngineConstants::World::BROADPHASE_CELL_SIZE);
   m_collisionResolutionSystem = std::make_unique<CollisionResolutionSystem>();
   m_movementSystem = std::make_unique<MovementSystem>();
+  m_transformSystem = std::make_unique<TransformSystem>();
+  // The boundary system keeps triangles inside the grid, so the renderer
+  // can take its visible candidates from the same partition
+  m_renderer->setCullingPartition(&m_collisionDetectionSystem->getBroadphase());
   
   // Initialize boundary system with world bounds
   BoundaryConstraint worldBounds(
@@ -69,7 +95,14 @@ GameScene::GameScene(sf::RenderWindow &window) : m_window(window) {
   m_collisionResolutionSystem->setEntityResponse(EntityTag::TRIANGLE, 
       CollisionResponse(CollisionResponseType::DAMPED, 0.9f, 0.1f));
 
-  spawnTriangle();
+  // Movement, boundary test and broadphase pair generation run data-parallel
+  m_movementSystem->setJobSystem(m_jobs);
+  m_transformSystem->setJobSystem(m_jobs);
+  m_boundarySystem->setJobSystem(m_jobs);
+  m_collisionDetectionSystem->setJobSystem(m_jobs);
+  buildPhysicsSchedule();
+
+  spawnTriangle(entityCount);
 };
 
 std::shared_ptr<Camera> GameScene::camera() { return m_camera; };
@@ -143,25 +176,39 @@ void GameScene::onLoad() {
   
   // Enable mouse capture by default
   captureMouse();
+
+  if (m_gridVisible) {
+    createGrid();
+  }
 };
 
-void GameScene::spawnTriangle() {
-  for (int i = 0; i < EngineConstants::World::ENTITY_GRID_SIZE; i++) {
-    for (int j = 0; j < EngineConstants::World::ENTITY_GRID_SIZE; j++) {
-      for (int k = 0; k < EngineConstants::World::ENTITY_GRID_SIZE; k++) {
+void GameScene::spawnTriangle(size_t count) {
+  // Fill a cube of grid positions in i, j, k order until count is reached
+  size_t side = 1;
+  while (side * side * side < count) {
+    side++;
+  }
+  size_t spawned = 0;
+  for (size_t i = 0; i < side && spawned < count; i++) {
+    for (size_t j = 0; j < side && spawned < count; j++) {
+      for (size_t k = 0; k < side && spawned < count; k++, spawned++) {
         LOG_DEBUG_STREAM("GameScene: Spawning triangle at position "
                          << i << ", " << j << ", " << k);
+        float x = static_cast<float>(i);
+        float y = static_cast<float>(j);
+        float z = static_cast<float>(k);
         auto e = m_entityManager.addEntity(EntityTag::TRIANGLE);
         e->add<CTransform3D>(
-            glm::vec3{i * EngineConstants::World::ENTITY_SPACING_X,
-                      j * EngineConstants::World::ENTITY_SPACING_Y,
-                      k * EngineConstants::World::ENTITY_SPACING_Z},
+            glm::vec3{x * EngineConstants::World::ENTITY_SPACING_X,
+                      y * EngineConstants::World::ENTITY_SPACING_Y,
+                      z * EngineConstants::World::ENTITY_SPACING_Z},
             glm::vec3{0.0f}, glm::vec3{1.0f});
+        e->add<CModelMatrix>();
         e->add<CTriangle>();
         e->add<CAABB>(glm::vec3{0.0f, 0.0f, 0.0f}, // Center relative to entity position
                       glm::vec3{0.5f, 0.5f, 0.5f}); // Half-extents for triangle bounding box
-        e->add<CMovement3D>(glm::vec3{i * 1.0f, j * 1.0f, k * 1.0f},
-                            glm::vec3{0.5f * j, 0.5f * i, 0.5f * k});
+        e->add<CMovement3D>(glm::vec3{x * 1.0f, y * 1.0f, z * 1.0f},
+                            glm::vec3{0.5f * y, 0.5f * x, 0.5f * z});
       }
     }
   }
@@ -210,27 +257,43 @@ bool GameScene::AABBIntersect(const CAABB &a, const CAABB &b) {
          (a.max.z > b.min.z && a.min.z < b.max.z);
 };
 
+void GameScene::buildPhysicsSchedule() {
+  // Registration order is the serial order; conflicting systems keep it
+  m_physicsSchedule.setJobSystem(m_jobs);
+  m_physicsSchedule.addSystem(
+      "movement", SystemAccess().writes<CTransform3D, CMovement3D>(),
+      [this](float deltaTime) {
+        m_movementSystem->updateMovement(m_entityManager, deltaTime);
+      });
+  m_physicsSchedule.addSystem(
+      "collision_detection",
+      SystemAccess().reads<CTransform3D>().writes<CAABB>().writesResource("collisions"),
+      [this](float) {
+        m_collisions = m_collisionDetectionSystem->detectCollisions(m_entityManager);
+      });
+  m_physicsSchedule.addSystem(
+      "collision_resolution",
+      SystemAccess().readsResource("collisions").writes<CTransform3D, CMovement3D>(),
+      [this](float) { m_collisionResolutionSystem->resolveCollisions(m_collisions); });
+  m_physicsSchedule.addSystem(
+      "boundaries", SystemAccess().writes<CTransform3D, CMovement3D>(),
+      [this](float) { m_boundarySystem->enforceBoundaries(m_entityManager); });
+}
+
 void GameScene::sMovement(float deltaTime) {
   if (m_paused) {
     return; // Skip physics update when paused
   }
   
   LOG_DEBUG("GameScene: Running physics update with new systems");
-  
-  // 1. Update movement (position from velocity, velocity from acceleration)
-  m_movementSystem->updateMovement(m_entityManager, deltaTime);
-  
-  // 2. Detect collisions between entities
-  auto collisions = m_collisionDetectionSystem->detectCollisions(m_entityManager);
-  
-  // 3. Resolve collisions (apply physics response)
-  m_collisionResolutionSystem->resolveCollisions(collisions);
-  
-  // 4. Enforce world boundaries
-  m_boundarySystem->enforceBoundaries(m_entityManager);
-  
-  // 5. Update legacy collision system for compatibility (if needed by other systems)
-  m_collisionSystem->updateEntities(m_entityManager);
+  m_interpolator.capture(m_entityManager);
+  m_physicsSchedule.run(deltaTime);
+
+  // Dump once, after the first frame so the timings are real
+  if (!m_scheduleLogged) {
+    LOG_INFO_STREAM("GameScene: " << m_physicsSchedule.getScheduleDump());
+    m_scheduleLogged = true;
+  }
 };
 
 void GameScene::handleMouseMovement(int mouseX, int mouseY, float deltaTime) {
@@ -298,9 +361,9 @@ void GameScene::handleMouseMovement(int mouseX, int mouseY, float deltaTime) {
 }
 
 void GameScene::captureMouse() {
-  if (EngineConstants::Input::ENABLE_MOUSE_CAPTURE) {
+  if (EngineConstants::Input::ENABLE_MOUSE_CAPTURE && m_window) {
     m_mouseCapture = true;
-    m_window.setMouseCursorVisible(false);
+    m_window->setMouseCursorVisible(false);
     
     // Reset mouse tracking state
     m_firstMouseMovement = true;
@@ -313,14 +376,18 @@ void GameScene::captureMouse() {
 
 void GameScene::releaseMouse() {
   m_mouseCapture = false;
-  m_window.setMouseCursorVisible(true);
+  if (m_window) {
+    m_window->setMouseCursorVisible(true);
+  }
   LOG_INFO("GameScene: Mouse released");
 }
 
 void GameScene::toggleGrid() {
   m_gridVisible = !m_gridVisible;
-  if (m_gridVisible && !m_gridCreated) {
+  if (m_gridVisible) {
     createGrid();
+  } else {
+    destroyGrid();
   }
   LOG_INFO_STREAM("GameScene: Grid visibility toggled to " << (m_gridVisible ? "ON" : "OFF"));
 }
@@ -333,6 +400,13 @@ void GameScene::createGrid() {
   float halfSize = EngineConstants::UI::GRID_3D_SIZE / 2.0f;
   float spacing = EngineConstants::UI::GRID_3D_SPACING;
   float majorSpacing = EngineConstants::UI::GRID_3D_MAJOR_SPACING;
+  float lineWidth = EngineConstants::UI::GRID_3D_LINE_WIDTH *
+                    EngineConstants::Graphics::LINE_WIDTH_PIXELS_PER_UNIT;
+  float axisWidth = 0.05f * EngineConstants::Graphics::LINE_WIDTH_PIXELS_PER_UNIT;
+  
+  // The grid never moves, so it is built once into a line batch the
+  // renderer keeps on the GPU, rather than one entity per line
+  m_gridLines.clear();
   
   // Create grid lines in X-Z plane (Y = 0)
   for (float x = -halfSize; x <= halfSize; x += spacing) {
@@ -340,10 +414,7 @@ void GameScene::createGrid() {
     glm::vec3 color = isMajor ? glm::vec3(0.8f, 0.8f, 0.8f) : glm::vec3(0.4f, 0.4f, 0.4f);
     
     // Vertical lines (parallel to Z axis)
-    auto lineEntity = m_entityManager.addEntity(EntityTag::TRIANGLE); // Reuse triangle tag for now
-    lineEntity->add<CTransform3D>(glm::vec3(0.0f), glm::vec3(0.0f), glm::vec3(1.0f));
-    lineEntity->add<CGridLine>(glm::vec3(x, 0, -halfSize), glm::vec3(x, 0, halfSize), color, 
-                               EngineConstants::UI::GRID_3D_LINE_WIDTH, isMajor);
+    m_gridLines.addLine(glm::vec3(x, 0, -halfSize), glm::vec3(x, 0, halfSize), color, lineWidth);
   }
   
   for (float z = -halfSize; z <= halfSize; z += spacing) {
@@ -351,36 +422,27 @@ void GameScene::createGrid() {
     glm::vec3 color = isMajor ? glm::vec3(0.8f, 0.8f, 0.8f) : glm::vec3(0.4f, 0.4f, 0.4f);
     
     // Horizontal lines (parallel to X axis)
-    auto lineEntity = m_entityManager.addEntity(EntityTag::TRIANGLE); // Reuse triangle tag for now
-    lineEntity->add<CTransform3D>(glm::vec3(0.0f), glm::vec3(0.0f), glm::vec3(1.0f));
-    lineEntity->add<CGridLine>(glm::vec3(-halfSize, 0, z), glm::vec3(halfSize, 0, z), color,
-                               EngineConstants::UI::GRID_3D_LINE_WIDTH, isMajor);
+    m_gridLines.addLine(glm::vec3(-halfSize, 0, z), glm::vec3(halfSize, 0, z), color, lineWidth);
   }
   
   // Add coordinate axes (X=red, Y=green, Z=blue)
-  auto xAxis = m_entityManager.addEntity(EntityTag::TRIANGLE);
-  xAxis->add<CTransform3D>(glm::vec3(0.0f), glm::vec3(0.0f), glm::vec3(1.0f));
-  xAxis->add<CGridLine>(glm::vec3(-halfSize, 0, 0), glm::vec3(halfSize, 0, 0), 
-                        glm::vec3(1.0f, 0.0f, 0.0f), 0.05f, true); // Red X-axis
-  
-  auto zAxis = m_entityManager.addEntity(EntityTag::TRIANGLE);
-  zAxis->add<CTransform3D>(glm::vec3(0.0f), glm::vec3(0.0f), glm::vec3(1.0f));
-  zAxis->add<CGridLine>(glm::vec3(0, 0, -halfSize), glm::vec3(0, 0, halfSize), 
-                        glm::vec3(0.0f, 0.0f, 1.0f), 0.05f, true); // Blue Z-axis
-  
-  auto yAxis = m_entityManager.addEntity(EntityTag::TRIANGLE);
-  yAxis->add<CTransform3D>(glm::vec3(0.0f), glm::vec3(0.0f), glm::vec3(1.0f));
-  yAxis->add<CGridLine>(glm::vec3(0, -halfSize/2, 0), glm::vec3(0, halfSize/2, 0), 
-                        glm::vec3(0.0f, 1.0f, 0.0f), 0.05f, true); // Green Y-axis
+  m_gridLines.addLine(glm::vec3(-halfSize, 0, 0), glm::vec3(halfSize, 0, 0),
+                      glm::vec3(1.0f, 0.0f, 0.0f), axisWidth); // Red X-axis
+  m_gridLines.addLine(glm::vec3(0, 0, -halfSize), glm::vec3(0, 0, halfSize),
+                      glm::vec3(0.0f, 0.0f, 1.0f), axisWidth); // Blue Z-axis
+  m_gridLines.addLine(glm::vec3(0, -halfSize/2, 0), glm::vec3(0, halfSize/2, 0),
+                      glm::vec3(0.0f, 1.0f, 0.0f), axisWidth); // Green Y-axis
   
+  m_renderer->setStaticLines(m_gridLines);
   m_gridCreated = true;
-  LOG_INFO_STREAM("GameScene: Created grid with " << (int)(2 * (halfSize * 2 / spacing + 1)) << " lines");
+  LOG_INFO_STREAM("GameScene: Created grid with " << m_gridLines.lineCount() << " lines");
 }
 
 void GameScene::destroyGrid() {
   if (!m_gridCreated) return;
   
-  LOG_INFO("GameScene: Destroying grid (not implemented - grid entities persist)");
-  // TODO: Implement grid entity removal by tracking grid entities
+  LOG_INFO("GameScene: Destroying grid");
+  m_gridLines.clear();
+  m_renderer->setStaticLines(m_gridLines);
   m_gridCreated = false;
 }
@@ -0,0 +1,79 @@
+#include "../include/HeadlessRunner.hpp"
+#include "../include/GameScene.h"
+#include "../include/JobSystem.hpp"
+#include "../include/Logger.hpp"
+#include <chrono>
+#include <iomanip>
+
+HeadlessRunner::Report HeadlessRunner::run(const Options& options) {
+    Report report;
+    report.options = options;
+
+    // The caller runs jobs too, so N threads is N - 1 workers
+    JobSystem jobs(options.threads > 0 ? options.threads - 1 : JobSystem::defaultWorkerCount());
+    report.threads = jobs.getThreadCount();
+
+    GameScene scene(&jobs, options.entities);
+    BaseScene& baseScene = scene; // The tick methods are public through the scene interface
+    SystemScheduler& schedule = scene.physicsSchedule();
+    const float step = 1.0f / options.tickRate;
+
+    // One untimed tick applies the spawns and builds the broadphase
+    baseScene.update(step);
+    baseScene.sMovement(step);
+
+    report.systems.resize(schedule.getSystemCount());
+    for (size_t i = 0; i < report.systems.size(); ++i) {
+        report.systems[i].name = schedule.getStats(i).name;
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (size_t tick = 0; tick < options.ticks; ++tick) {
+        baseScene.update(step);
+        baseScene.sMovement(step);
+        baseScene.sRender();
+        for (size_t i = 0; i < report.systems.size(); ++i) {
+            report.systems[i].totalMs += schedule.getStats(i).lastMs;
+        }
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    report.ticks = options.ticks;
+    report.totalMs = std::chrono::duration<double, std::milli>(end - start).count();
+    report.ticksPerSecond = report.totalMs > 0.0 ? report.ticks * 1000.0 / report.totalMs : 0.0;
+    report.entities = scene.entityCount();
+    report.framesRendered = scene.headlessRenderer()->getFrameCount();
+
+    double systemsMs = 0.0;
+    for (const auto& system : report.systems) {
+        systemsMs += system.totalMs;
+    }
+    for (auto& system : report.systems) {
+        system.averageMs = report.ticks > 0 ? system.totalMs / report.ticks : 0.0;
+        system.share = systemsMs > 0.0 ? system.totalMs / systemsMs : 0.0;
+    }
+
+    LOG_INFO_STREAM("HeadlessRunner: " << report.ticks << " ticks of " << report.entities
+                    << " entities in " << report.totalMs << " ms");
+    return report;
+}
+
+void HeadlessRunner::printReport(const Report& report, std::ostream& out) {
+    std::ios::fmtflags flags = out.flags();
+    std::streamsize precision = out.precision();
+    out << "Headless run: " << report.entities << " entities, " << report.ticks << " ticks at "
+        << report.options.tickRate << " Hz step, " << report.threads << " threads\n";
+    out << std::fixed << std::setprecision(3);
+    out << "  total " << report.totalMs << " ms, " << std::setprecision(1)
+        << report.ticksPerSecond << " ticks/s (" << std::setprecision(3)
+        << (report.ticks > 0 ? report.totalMs / report.ticks : 0.0) << " ms/tick)\n";
+    out << "  " << std::left << std::setw(24) << "system" << std::right << std::setw(12)
+        << "ms/tick" << std::setw(10) << "share" << "\n";
+    for (const auto& system : report.systems) {
+        out << "  " << std::left << std::setw(24) << system.name << std::right << std::setw(12)
+            << std::setprecision(3) << system.averageMs << std::setw(9) << std::setprecision(1)
+            << system.share * 100.0 << "%\n";
+    }
+    out.flags(flags);
+    out.precision(precision);
+}
@@ -0,0 +1,18 @@
+#version 330 core
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aColor;
+layout (location = 2) in mat4 aModel; // Per instance, locations 2-5
+
+out vec3 currColor;
+out vec4 ViewPos;
+
+layout (std140) uniform Camera {
+  mat4 view;
+  mat4 projection;
+};
+
+void main() {
+  ViewPos = view * aModel * vec4(aPos, 1.0);
+  gl_Position = projection * ViewPos;
+  currColor = aColor;
+}
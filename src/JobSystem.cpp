@@ -0,0 +1,212 @@
+#include "../include/JobSystem.hpp"
+#include "../include/Constants.hpp"
+
+namespace {
+// Pool the current thread works for, and its queue index in that pool
+thread_local const JobSystem* t_jobSystem = nullptr;
+thread_local size_t t_threadIndex = 0;
+} // namespace
+
+/**
+ * Ring-buffer deque; the owner uses the back, thieves take from the front
+ */
+struct alignas(64) JobSystem::WorkQueue {
+    std::mutex mutex;
+    std::vector<Job> ring;
+    size_t head = 0; // Front (steal end)
+    size_t count = 0;
+
+    WorkQueue() : ring(EngineConstants::Jobs::INITIAL_QUEUE_CAPACITY) {}
+
+    void pushBack(const Job& job) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (count == ring.size()) {
+            // Unwrap into a buffer twice the size
+            std::vector<Job> grown(ring.size() * 2);
+            for (size_t i = 0; i < count; ++i) {
+                grown[i] = ring[(head + i) % ring.size()];
+            }
+            ring.swap(grown);
+            head = 0;
+        }
+        ring[(head + count) % ring.size()] = job;
+        count++;
+    }
+
+    bool popBack(Job& job) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (count == 0) {
+            return false;
+        }
+        count--;
+        job = ring[(head + count) % ring.size()];
+        return true;
+    }
+
+    bool popFront(Job& job) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (count == 0) {
+            return false;
+        }
+        job = ring[head];
+        head = (head + 1) % ring.size();
+        count--;
+        return true;
+    }
+};
+
+JobSystem::JobSystem(size_t workerCount) {
+    for (size_t i = 0; i <= workerCount; ++i) {
+        m_queues.push_back(std::make_unique<WorkQueue>());
+    }
+
+    m_workers.reserve(workerCount);
+    for (size_t i = 0; i < workerCount; ++i) {
+        m_workers.emplace_back(&JobSystem::workerLoop, this, i + 1);
+    }
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_stopping = true;
+    }
+    m_wake.notify_all();
+    for (auto& worker : m_workers) {
+        worker.join();
+    }
+}
+
+size_t JobSystem::defaultWorkerCount() {
+    unsigned hardwareThreads = std::thread::hardware_concurrency();
+    return hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+}
+
+size_t JobSystem::getCurrentThreadIndex() const {
+    return t_jobSystem == this ? t_threadIndex : 0;
+}
+
+void JobSystem::enqueue(Job job, JobCounter* after) {
+    job.counter->m_pending.fetch_add(1);
+    if (after) {
+        // Checked under the dependency's lock so its final decrement cannot slip between
+        std::lock_guard<std::mutex> lock(after->m_mutex);
+        if (!after->isDone()) {
+            after->m_continuations.push_back(job);
+            return;
+        }
+    }
+    push(getCurrentThreadIndex(), job);
+}
+
+void JobSystem::runAndWait(Job job, JobCounter& counter) {
+    job.counter = &counter;
+    counter.m_pending.store(1);
+    execute(job, getCurrentThreadIndex());
+    wait(counter);
+}
+
+void JobSystem::execute(Job job, size_t thread) {
+    // Split off upper halves for thieves until the rest fits in one grain
+    while (job.end - job.begin > job.grain) {
+        size_t mid = job.begin + (job.end - job.begin) / 2;
+        Job upper = job;
+        upper.begin = mid;
+        job.counter->m_pending.fetch_add(1);
+        push(thread, upper);
+        job.end = mid;
+    }
+    job.fn(job.context, job.begin, job.end, thread);
+    finish(*job.counter, thread);
+}
+
+void JobSystem::finish(JobCounter& counter, size_t thread) {
+    // Not the last job: a plain decrement
+    size_t pending = counter.m_pending.load();
+    while (pending > 1) {
+        if (counter.m_pending.compare_exchange_weak(pending, pending - 1)) {
+            return;
+        }
+    }
+
+    // Last job: decrement under the counter's lock, which wait() takes before
+    // returning, so the counter is not destroyed while still in use here
+    std::vector<Job> ready;
+    {
+        std::lock_guard<std::mutex> lock(counter.m_mutex);
+        if (counter.m_pending.fetch_sub(1) != 1) {
+            return;
+        }
+        ready.swap(counter.m_continuations);
+    }
+    for (const Job& job : ready) {
+        push(thread, job);
+    }
+
+    // Wake anyone in wait() on this counter
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+    }
+    m_wake.notify_all();
+}
+
+void JobSystem::push(size_t thread, const Job& job) {
+    m_queuedJobs.fetch_add(1); // Before the push, so a thief's decrement cannot wrap it
+    m_queues[thread]->pushBack(job);
+    {
+        // Empty critical section orders the push before any sleeper's predicate check
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+    }
+    m_wake.notify_one();
+}
+
+bool JobSystem::findJob(size_t thread, Job& job) {
+    if (m_queuedJobs.load() == 0) {
+        return false;
+    }
+    if (m_queues[thread]->popBack(job)) {
+        m_queuedJobs.fetch_sub(1);
+        return true;
+    }
+    for (size_t i = 1; i < m_queues.size(); ++i) {
+        size_t victim = (thread + i) % m_queues.size();
+        if (m_queues[victim]->popFront(job)) {
+            m_queuedJobs.fetch_sub(1);
+            return true;
+        }
+    }
+    return false;
+}
+
+void JobSystem::wait(JobCounter& counter) {
+    size_t thread = getCurrentThreadIndex();
+    Job job;
+    while (!counter.isDone()) {
+        if (findJob(thread, job)) {
+            execute(job, thread);
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(m_sleepMutex);
+        m_wake.wait(lock, [&]() { return counter.isDone() || m_queuedJobs.load() > 0; });
+    }
+    // Let the finishing thread release the counter before the caller can destroy it
+    std::lock_guard<std::mutex> lock(counter.m_mutex);
+}
+
+void JobSystem::workerLoop(size_t thread) {
+    t_jobSystem = this;
+    t_threadIndex = thread;
+
+    Job job;
+    while (true) {
+        if (findJob(thread, job)) {
+            execute(job, thread);
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(m_sleepMutex);
+        m_wake.wait(lock, [&]() { return m_stopping || m_queuedJobs.load() > 0; });
+        if (m_stopping) {
+            return;
+        }
+    }
+}
@@ -4,33 +4,39 @@
 #include <glm/gtc/matrix_transform.hpp>
 
 void MovementSystem::updateMovement(EntityManager& entityManager, float deltaTime) {
-    int entitiesUpdated = 0;
+    dropStaleEntries(entityManager);
     
-    for (auto& entity : entityManager.getEntities()) {
-        if (!entity->has<CTransform3D>() || !entity->has<CMovement3D>()) {
-            continue;
-        }
-        
-        // Apply accumulated forces
-        auto forceIt = m_accumulatedForces.find(entity->id());
-        if (forceIt != m_accumulatedForces.end()) {
-            addForce(entity, forceIt->second);
-            m_accumulatedForces.erase(forceIt);
+    // Forces first, so the integration below only touches its own entity's components
+    applyPendingForces(deltaTime);
+    
+    // Constant spin (from the original GameScene logic)
+    const glm::vec3 rotationDelta = glm::vec3(EngineConstants::World::ENTITY_ROTATION_RATE) * deltaTime;
+    const float* maxSpeeds = m_hasSpeedLimits ? m_maxSpeeds.data() : nullptr;
+    const size_t maxSpeedCount = m_maxSpeeds.size();
+    
+    // Same step as MovementBatch::integrateScalar, applied in place
+    auto integrate = [&](size_t entityID, CTransform3D& transform, CMovement3D& movement) {
+        movement.vel += movement.acc * deltaTime;
+        if (maxSpeeds && entityID < maxSpeedCount) {
+            float speed = glm::length(movement.vel);
+            if (speed > maxSpeeds[entityID]) {
+                movement.vel *= maxSpeeds[entityID] / speed;
+            }
         }
-        
-        // Update velocity from acceleration
-        updateVelocity(entity, deltaTime);
-        
-        // Apply speed limits
-        applySpeedLimit(entity);
-        
-        // Update position from velocity
-        updatePosition(entity, deltaTime);
-        
-        // Apply rotation updates
-        applyRotation(entity, deltaTime);
-        
-        entitiesUpdated++;
+        transform.position += movement.vel * deltaTime;
+        transform.rotation += rotationDelta;
+        transform.dirty = true;
+    };
+    
+    size_t entitiesUpdated = 0;
+    auto view = entityManager.view<CTransform3D, CMovement3D>();
+    if (m_jobs) {
+        entitiesUpdated = view.parallelEach(*m_jobs, integrate);
+    } else {
+        view.each([&](size_t entityID, CTransform3D& transform, CMovement3D& movement) {
+            integrate(entityID, transform, movement);
+            entitiesUpdated++;
+        });
     }
     
     if (entitiesUpdated > 0) {
@@ -38,6 +44,27 @@ void MovementSystem::updateMovement(EntityManager& entityManager, float deltaTim
     }
 }
 
+void MovementSystem::applyPendingForces(float deltaTime) {
+    if (m_forcedEntities.empty()) {
+        return;
+    }
+    
+    // Unit mass, so force acts as acceleration this frame. Forces on entities
+    // that are not movers (yet) stay pending, as before.
+    ComponentManager* components = Entity::getComponentManager();
+    size_t kept = 0;
+    for (size_t entityID : m_forcedEntities) {
+        if (components->hasComponent<CTransform3D>(entityID) && components->hasComponent<CMovement3D>(entityID)) {
+            components->getComponent<CMovement3D>(entityID).vel += m_pendingForces[entityID] * deltaTime;
+            m_pendingForces[entityID] = glm::vec3(0.0f);
+            m_hasPendingForce[entityID] = 0;
+        } else {
+            m_forcedEntities[kept++] = entityID;
+        }
+    }
+    m_forcedEntities.resize(kept);
+}
+
 void MovementSystem::applyImpulse(std::shared_ptr<Entity> entity, const glm::vec3& impulse) {
     if (!entity->has<CMovement3D>()) {
         return;
@@ -66,11 +93,60 @@ void MovementSystem::addForce(std::shared_ptr<Entity> entity, const glm::vec3& f
     }
     
     // Accumulate forces to be applied in next update
-    m_accumulatedForces[entity->id()] += force;
+    size_t entityID = entity->id();
+    if (entityID >= m_pendingForces.size()) {
+        m_pendingForces.resize(entityID + 1, glm::vec3(0.0f));
+        m_hasPendingForce.resize(entityID + 1, 0);
+        m_forceOwners.resize(entityID + 1);
+    }
+    if (m_hasPendingForce[entityID] && m_forceOwners[entityID] != entity->handle()) {
+        m_pendingForces[entityID] = glm::vec3(0.0f); // Left over from the slot's previous entity
+    }
+    if (!m_hasPendingForce[entityID]) {
+        m_hasPendingForce[entityID] = 1;
+        m_forcedEntities.push_back(entityID);
+    }
+    m_forceOwners[entityID] = entity->handle();
+    m_pendingForces[entityID] += force;
 }
 
 void MovementSystem::setMaxSpeed(std::shared_ptr<Entity> entity, float maxSpeed) {
-    m_entityMaxSpeeds[entity->id()] = maxSpeed;
+    size_t entityID = entity->id();
+    if (entityID >= m_maxSpeeds.size()) {
+        m_maxSpeeds.resize(entityID + 1, MovementBatch::NO_SPEED_LIMIT);
+        m_limitOwners.resize(entityID + 1);
+    }
+    if (m_maxSpeeds[entityID] == MovementBatch::NO_SPEED_LIMIT) {
+        m_limitedEntities.push_back(entityID);
+    }
+    m_maxSpeeds[entityID] = maxSpeed;
+    m_limitOwners[entityID] = entity->handle();
+    m_hasSpeedLimits = true;
+}
+
+void MovementSystem::dropStaleEntries(const EntityManager& entityManager) {
+    size_t kept = 0;
+    for (size_t entityID : m_limitedEntities) {
+        if (m_maxSpeeds[entityID] != MovementBatch::NO_SPEED_LIMIT &&
+            entityManager.getEntity(m_limitOwners[entityID])) {
+            m_limitedEntities[kept++] = entityID;
+        } else {
+            m_maxSpeeds[entityID] = MovementBatch::NO_SPEED_LIMIT;
+        }
+    }
+    m_limitedEntities.resize(kept);
+    m_hasSpeedLimits = !m_limitedEntities.empty();
+    
+    kept = 0;
+    for (size_t entityID : m_forcedEntities) {
+        if (entityManager.getEntity(m_forceOwners[entityID])) {
+            m_forcedEntities[kept++] = entityID;
+        } else {
+            m_pendingForces[entityID] = glm::vec3(0.0f);
+            m_hasPendingForce[entityID] = 0;
+        }
+    }
+    m_forcedEntities.resize(kept);
 }
 
 void MovementSystem::applyDamping(std::shared_ptr<Entity> entity, float dampingFactor) {
@@ -82,44 +158,3 @@ void MovementSystem::applyDamping(std::shared_ptr<Entity> entity, float dampingF
     movement.vel *= dampingFactor;
     movement.acc *= dampingFactor;
 }
-
-void MovementSystem::updatePosition(std::shared_ptr<Entity> entity, float deltaTime) {
-    auto& transform = entity->get<CTransform3D>();
-    const auto& movement = entity->get<CMovement3D>();
-    
-    // Basic Euler integration: position += velocity * deltaTime
-    transform.position += movement.vel * deltaTime;
-}
-
-void MovementSystem::updateVelocity(std::shared_ptr<Entity> entity, float deltaTime) {
-    auto& movement = entity->get<CMovement3D>();
-    
-    // Basic Euler integration: velocity += acceleration * deltaTime
-    movement.vel += movement.acc * deltaTime;
-}
-
-void MovementSystem::applySpeedLimit(std::shared_ptr<Entity> entity) {
-    auto speedIt = m_entityMaxSpeeds.find(entity->id());
-    if (speedIt == m_entityMaxSpeeds.end()) {
-        return; // No speed limit set for this entity
-    }
-    
-    auto& movement = entity->get<CMovement3D>();
-    float currentSpeed = glm::length(movement.vel);
-    
-    if (currentSpeed > speedIt->second) {
-        // Normalize velocity and scale to max speed
-        movement.vel = glm::normalize(movement.vel) * speedIt->second;
-    }
-}
-
-void MovementSystem::applyRotation(std::shared_ptr<Entity> entity, float deltaTime) {
-    auto& transform = entity->get<CTransform3D>();
-    
-    // Apply constant rotation (from existing GameScene logic)
-    glm::vec3 rotationDelta = glm::vec3(EngineConstants::World::ENTITY_ROTATION_RATE,
-                                       EngineConstants::World::ENTITY_ROTATION_RATE,
-                                       EngineConstants::World::ENTITY_ROTATION_RATE) * deltaTime;
-    transform.rotation += rotationDelta;
-    
-}
\ No newline at end of file
@@ -1,27 +1,28 @@
 #include "../include/OpenGLRenderer.hpp"
 #include "../include/Constants.hpp"
-#include "../include/FileLoader.h"
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <glm/ext/matrix_float4x4.hpp>
 #include <glm/gtc/type_ptr.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <iostream>
 #include <memory>
 #include <ostream>
 
-// Load shader sources safely using RAII
-static const std::string vertexShaderSourceStr =
-    FileLoader::loadFileAsString("./src/ColorShader.vert");
-static const std::string fragmentShaderSourceStr =
-    FileLoader::loadFileAsString("./src/DepthFragment.frag");
-
-static const char *vertexShaderSource = vertexShaderSourceStr.c_str();
-static const char *fragmentShaderSource = fragmentShaderSourceStr.c_str();
+// Sort-key ids for the render queue (see RenderQueue for the key layout)
+namespace {
+constexpr uint32_t SHADER_INSTANCED = 0;
+constexpr uint32_t SHADER_COLOR = 1;
+constexpr uint32_t MESH_SHARED_TRIANGLE = 0;
+constexpr uint32_t MESH_CUSTOM_TRIANGLE = 1;
+} // namespace
 
 std::shared_ptr<Camera> OpenGLRenderer::camera() { return m_camera; };
 
 OpenGLRenderer::OpenGLRenderer(std::shared_ptr<Camera> camera,
                                sf::RenderWindow &window)
-    : m_camera(camera), m_window(window), VAO(0), VBO(0), shaderProgram(0),
+    : m_camera(camera), m_window(window), VAO(0), VBO(0),
       m_initialized(false) {
   m_window.setActive(true); // active opengl context
   if (!gladLoadGL()) {
@@ -35,38 +36,26 @@ OpenGLRenderer::~OpenGLRenderer() {
   if (m_initialized) {
     GL_CALL(glDeleteVertexArrays(1, &VAO));
     GL_CALL(glDeleteBuffers(1, &VBO));
-    GL_CALL(glDeleteProgram(shaderProgram));
+    GL_CALL(glDeleteVertexArrays(1, &m_triangleVAO));
+    GL_CALL(glDeleteBuffers(1, &m_meshVBO));
+    GL_CALL(glDeleteBuffers(1, &m_instanceVBO));
+    GL_CALL(glDeleteBuffers(1, &m_cameraUBO));
+    GL_CALL(glDeleteVertexArrays(1, &m_staticLineVAO));
+    GL_CALL(glDeleteBuffers(1, &m_staticLineVBO));
   }
 };
 
 void OpenGLRenderer::init() {
   std::cout << "init called" << std::endl;
-  // compile shaders
-  unsigned int vertexShader =
-      compileShader(vertexShaderSource, GL_VERTEX_SHADER);
-  unsigned int fragmentShader =
-      compileShader(fragmentShaderSource, GL_FRAGMENT_SHADER);
-
-  // create shader program
-  shaderProgram = glCreateProgram();
-  GL_CHECK_ERROR();
-  GL_CALL(glAttachShader(shaderProgram, vertexShader));
-  GL_CALL(glAttachShader(shaderProgram, fragmentShader));
-  GL_CALL(glLinkProgram(shaderProgram));
-
-  // check for linking errors
-  int success;
-  GL_CALL(glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success));
-  if (!success) {
-    char infoLog[EngineConstants::Graphics::SHADER_LOG_BUFFER_SIZE];
-    GL_CALL(glGetProgramInfoLog(
-        shaderProgram, EngineConstants::Graphics::SHADER_LOG_BUFFER_SIZE,
-        nullptr, infoLog));
-    std::cerr << "Shader program linking failed: \n" << infoLog << std::endl;
-  }
-
-  GL_CALL(glDeleteShader(vertexShader));
-  GL_CALL(glDeleteShader(fragmentShader));
+  m_colorShader = &m_shaders.load("color", "./src/ColorShader.vert",
+                                  "./src/DepthFragment.frag");
+  m_instancedShader = &m_shaders.load("instanced", "./src/InstancedShader.vert",
+                                      "./src/DepthFragment.frag");
+  m_colorModelLoc = m_colorShader->uniformLocation("model");
+  m_colorShader->bindUniformBlock("Camera",
+                                  EngineConstants::Graphics::CAMERA_UBO_BINDING);
+  m_instancedShader->bindUniformBlock(
+      "Camera", EngineConstants::Graphics::CAMERA_UBO_BINDING);
 
   setupBuffers();
   GL_CALL(glEnable(GL_DEPTH_TEST));
@@ -84,82 +73,21 @@ void OpenGLRenderer::render(const EntityVec &entities) {
                        EngineConstants::Graphics::CLEAR_COLOR_B,
                        EngineConstants::Graphics::CLEAR_COLOR_A));
   GL_CALL(glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT));
-  GL_CALL(glUseProgram(shaderProgram));
 
-  GL_CALL(glBindVertexArray(VAO));
+  // View and projection go to the camera UBO once; every program reads them from there
+  glm::mat4 camera[2] = {
+      m_camera->getViewMatrix(),
+      m_camera->getProjectionMatrix(EngineConstants::Display::ASPECT_RATIO)};
+  GL_CALL(glBindBuffer(GL_UNIFORM_BUFFER, m_cameraUBO));
+  GL_CALL(glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(camera), camera));
 
-  // Common view and projection matrices
-  glm::mat4 view = m_camera->getViewMatrix();
-  glm::mat4 projection = m_camera->getProjectionMatrix(EngineConstants::Display::ASPECT_RATIO);
+  renderTriangles(entities, camera[0], camera[1]);
   
-  // Render triangles
-  for (const auto &e : entities) {
-    if (e->has<CTriangle>() && e->has<CTransform3D>()) {
-      auto &triangle = e->get<CTriangle>();
-      auto &transform = e->get<CTransform3D>();
-
-      // Update buffer data
-      GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, VBO));
-      GL_CALL(glBufferData(
-          GL_ARRAY_BUFFER,
-          EngineConstants::Graphics::TRIANGLE_VERTEX_DATA_SIZE * sizeof(float),
-          triangle.vertices.data(), GL_DYNAMIC_DRAW));
-
-      // matrix transforms for model, view and projection space
-      glm::mat4 model = glm::mat4(1.0f);
-      model = glm::translate(model, transform.position);
-      model = glm::rotate(model, glm::radians(transform.rotation.x),
-                          glm::vec3(1.0f, 0.0f, 0.0f));
-      model = glm::rotate(model, glm::radians(transform.rotation.y),
-                          glm::vec3(0.0f, 1.0f, 0.0f));
-      model = glm::rotate(model, glm::radians(transform.rotation.z),
-                          glm::vec3(0.0f, 0.0f, 1.0f));
-      model = glm::scale(model, transform.scale);
-
-      // update uniform locations (could be cached for better performance)
-      GLint modelLoc = glGetUniformLocation(shaderProgram, "model");
-      GL_CHECK_ERROR();
-      GLint viewLoc = glGetUniformLocation(shaderProgram, "view");
-      GL_CHECK_ERROR();
-      GLint projLoc = glGetUniformLocation(shaderProgram, "projection");
-      GL_CHECK_ERROR();
-      GL_CALL(glad_glUniformMatrix4fv(modelLoc, 1, GL_FALSE,
-                                      glm::value_ptr(model)));
-      GL_CALL(
-          glad_glUniformMatrix4fv(viewLoc, 1, GL_FALSE, glm::value_ptr(view)));
-      GL_CALL(glad_glUniformMatrix4fv(projLoc, 1, GL_FALSE,
-                                      glm::value_ptr(projection)));
-
-      // draw call
-      GL_CALL(glDrawArrays(GL_TRIANGLES, 0, 3));
-    }
-  }
-  
-  // Render grid lines (if any) - for now always render, visibility is controlled by entity creation
-  renderGridLines(entities, view, projection);
+  renderLines(entities);
 
   GL_CALL(glBindVertexArray(0));
 };
 
-// shader compilation helper
-unsigned int OpenGLRenderer::compileShader(const char *source, GLenum type) {
-  unsigned int shader = glCreateShader(type);
-  GL_CHECK_ERROR();
-  GL_CALL(glShaderSource(shader, 1, &source, nullptr));
-  GL_CALL(glCompileShader(shader));
-
-  int success;
-  GL_CALL(glGetShaderiv(shader, GL_COMPILE_STATUS, &success));
-  if (!success) {
-    char infoLog[EngineConstants::Graphics::SHADER_LOG_BUFFER_SIZE];
-    GL_CALL(glGetShaderInfoLog(
-        shader, EngineConstants::Graphics::SHADER_LOG_BUFFER_SIZE, nullptr,
-        infoLog));
-    std::cerr << "Shader compilation failed: \n" << infoLog << std::endl;
-  }
-  return shader;
-};
-
 void OpenGLRenderer::setupBuffers() {
   // Create VAO and VBO once during initialization
   GL_CALL(glGenVertexArrays(1, &VAO));
@@ -168,7 +96,55 @@ void OpenGLRenderer::setupBuffers() {
   GL_CALL(glBindVertexArray(VAO));
   GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, VBO));
 
-  // Set up vertex attributes (position and color)
+  setupVertexAttributes();
+
+  GL_CALL(glBindVertexArray(0));
+
+  // Instanced triangles: the mesh never changes, so upload it once
+  m_sharedMesh = CTriangle().vertices;
+  m_sharedMeshRadius = meshRadius(m_sharedMesh);
+  GL_CALL(glGenVertexArrays(1, &m_triangleVAO));
+  GL_CALL(glGenBuffers(1, &m_meshVBO));
+  GL_CALL(glGenBuffers(1, &m_instanceVBO));
+
+  GL_CALL(glBindVertexArray(m_triangleVAO));
+  GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, m_meshVBO));
+  GL_CALL(glBufferData(GL_ARRAY_BUFFER, m_sharedMesh.size() * sizeof(float),
+                       m_sharedMesh.data(), GL_STATIC_DRAW));
+  setupVertexAttributes();
+
+  // A mat4 attribute takes four vec4 locations, advanced once per instance
+  GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, m_instanceVBO));
+  for (unsigned int column = 0; column < 4; ++column) {
+    unsigned int location =
+        EngineConstants::Graphics::INSTANCE_MODEL_ATTRIBUTE + column;
+    GL_CALL(glVertexAttribPointer(
+        location, 4, GL_FLOAT, GL_FALSE, sizeof(glm::mat4),
+        (void *)(column * sizeof(glm::vec4))));
+    GL_CALL(glEnableVertexAttribArray(location));
+    GL_CALL(glVertexAttribDivisor(location, 1));
+  }
+
+  // Static lines get their own buffer so they upload only when replaced
+  GL_CALL(glGenVertexArrays(1, &m_staticLineVAO));
+  GL_CALL(glGenBuffers(1, &m_staticLineVBO));
+  GL_CALL(glBindVertexArray(m_staticLineVAO));
+  GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, m_staticLineVBO));
+  setupVertexAttributes();
+
+  GL_CALL(glBindVertexArray(0));
+
+  // std140 Camera block: two mat4, no padding
+  GL_CALL(glGenBuffers(1, &m_cameraUBO));
+  GL_CALL(glBindBuffer(GL_UNIFORM_BUFFER, m_cameraUBO));
+  GL_CALL(glBufferData(GL_UNIFORM_BUFFER, 2 * sizeof(glm::mat4), nullptr,
+                       GL_DYNAMIC_DRAW));
+  GL_CALL(glBindBufferBase(GL_UNIFORM_BUFFER,
+                           EngineConstants::Graphics::CAMERA_UBO_BINDING,
+                           m_cameraUBO));
+}
+
+void OpenGLRenderer::setupVertexAttributes() {
   GL_CALL(glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE,
                                 EngineConstants::Graphics::VERTEX_STRIDE_SIZE *
                                     sizeof(float),
@@ -180,52 +156,230 @@ void OpenGLRenderer::setupBuffers() {
       (void *)(EngineConstants::Graphics::COLOR_ATTRIBUTE_OFFSET *
                sizeof(float))));
   GL_CALL(glEnableVertexAttribArray(1));
+}
 
-  GL_CALL(glBindVertexArray(0));
+void OpenGLRenderer::renderTriangles(const EntityVec &entities,
+                                     const glm::mat4 &view,
+                                     const glm::mat4 &projection) {
+  // Emit one command per visible triangle: instanced shared-mesh triangles
+  // and custom-mesh triangles sort into separate groups, front to back
+  m_queue.clear();
+  m_models.clear();
+  m_modelSources.clear();
+  m_cullStats = CullStats();
+
+  const Frustum frustum(projection * view);
+  if (m_cullPartition) {
+    // Only entities in cells overlapping the frustum's box are tested
+    m_cullStats.usedPartition = true;
+    m_cullPartition->query(frustum.bounds(), m_candidates);
+    ComponentManager *components = Entity::getComponentManager();
+    for (EntityID id : m_candidates) {
+      if (components->hasComponent<CTriangle>(id) &&
+          components->hasComponent<CTransform3D>(id)) {
+        const CModelMatrix *cached =
+            components->hasComponent<CModelMatrix>(id)
+                ? &components->getComponent<CModelMatrix>(id)
+                : nullptr;
+        submitTriangle(id, components->getComponent<CTriangle>(id),
+                       components->getComponent<CTransform3D>(id), cached,
+                       frustum, view);
+      }
+    }
+  } else {
+    for (const auto &e : entities) {
+      if (e->has<CTriangle>() && e->has<CTransform3D>()) {
+        const CModelMatrix *cached =
+            e->has<CModelMatrix>() ? &e->get<CModelMatrix>() : nullptr;
+        submitTriangle(e->id(), e->get<CTriangle>(), e->get<CTransform3D>(),
+                       cached, frustum, view);
+      }
+    }
+  }
+  m_cullStats.drawn = m_queue.size();
+  m_cullStats.culled = m_cullStats.tested - m_cullStats.drawn;
+  m_queue.sort();
+
+  // Walk runs of equal shader + mesh, binding only when they change
+  const auto &commands = m_queue.commands();
+  uint32_t boundShader = ~0u;
+  for (size_t begin = 0; begin < commands.size();) {
+    const uint64_t state = commands[begin].key >> RenderQueue::MESH_SHIFT;
+    size_t end = begin + 1;
+    while (end < commands.size() &&
+           (commands[end].key >> RenderQueue::MESH_SHIFT) == state) {
+      end++;
+    }
+    const uint32_t shader = RenderQueue::shaderOf(commands[begin].key);
+    if (shader != boundShader) {
+      (shader == SHADER_INSTANCED ? m_instancedShader : m_colorShader)->use();
+      boundShader = shader;
+    }
+    if (RenderQueue::meshOf(commands[begin].key) == MESH_SHARED_TRIANGLE) {
+      drawInstancedTriangles(begin, end);
+    } else {
+      drawCustomTriangles(begin, end);
+    }
+    begin = end;
+  }
 }
 
-void OpenGLRenderer::renderGridLines(const EntityVec &entities, const glm::mat4& view, const glm::mat4& projection) {
-  // Simple line rendering using GL_LINES
-  // This creates a thick line by rendering it as a series of small triangles
-  
+void OpenGLRenderer::submitTriangle(EntityID id, const CTriangle &triangle,
+                                    const CTransform3D &transform,
+                                    const CModelMatrix *cached,
+                                    const Frustum &frustum,
+                                    const glm::mat4 &view) {
+  m_cullStats.tested++;
+  glm::vec3 position = m_interpolator ? m_interpolator->position(id, transform)
+                                      : transform.position;
+
+  // Bounding sphere around the model origin, covering any rotation
+  bool shared = triangle.vertices == m_sharedMesh;
+  float radius = shared ? m_sharedMeshRadius : meshRadius(triangle.vertices);
+  glm::vec3 scale = glm::abs(transform.scale);
+  radius *= std::max(scale.x, std::max(scale.y, scale.z));
+  if (!frustum.intersectsSphere(position, radius)) {
+    return;
+  }
+
+  // Distance along the view direction: -z in view space
+  float depth = -(view[0][2] * position.x + view[1][2] * position.y +
+                  view[2][2] * position.z + view[3][2]);
+  // Triangles with their own vertices cannot share the instanced mesh
+  uint64_t key = RenderQueue::makeKey(
+      0, shared ? SHADER_INSTANCED : SHADER_COLOR,
+      shared ? MESH_SHARED_TRIANGLE : MESH_CUSTOM_TRIANGLE,
+      RenderQueue::depthBits(depth));
+  m_queue.submit(key, static_cast<uint32_t>(m_models.size()));
+  if (cached && !transform.dirty &&
+      (!m_interpolator || m_interpolator->rendersCurrent(id, transform))) {
+    m_models.push_back(cached->matrix);
+  } else {
+    glm::vec3 rotation = m_interpolator
+                             ? m_interpolator->rotation(id, transform)
+                             : transform.rotation;
+    m_models.push_back(
+        TransformSystem::modelMatrix(position, rotation, transform.scale));
+  }
+  m_modelSources.push_back(id);
+}
+
+float OpenGLRenderer::meshRadius(const std::vector<float> &vertices) {
+  float radiusSquared = 0.0f;
+  const size_t stride = EngineConstants::Graphics::VERTEX_STRIDE_SIZE;
+  for (size_t i = 0; i + 2 < vertices.size(); i += stride) {
+    glm::vec3 vertex(vertices[i], vertices[i + 1], vertices[i + 2]);
+    radiusSquared = std::max(radiusSquared, glm::dot(vertex, vertex));
+  }
+  return std::sqrt(radiusSquared);
+}
+
+void OpenGLRenderer::drawInstancedTriangles(size_t begin, size_t end) {
+  const auto &commands = m_queue.commands();
+  m_instanceModels.clear();
+  for (size_t i = begin; i < end; ++i) {
+    m_instanceModels.push_back(m_models[commands[i].index]);
+  }
+
+  // Orphan the instance buffer so the driver never waits on last frame's
+  // draw, growing it geometrically rather than every time a triangle spawns
+  GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, m_instanceVBO));
+  if (m_instanceModels.size() > m_instanceCapacity) {
+    m_instanceCapacity =
+        std::max(m_instanceModels.size(), m_instanceCapacity * 2);
+  }
+  GL_CALL(glBufferData(GL_ARRAY_BUFFER, m_instanceCapacity * sizeof(glm::mat4),
+                       nullptr, GL_STREAM_DRAW));
+  GL_CALL(glBufferSubData(GL_ARRAY_BUFFER, 0,
+                          m_instanceModels.size() * sizeof(glm::mat4),
+                          m_instanceModels.data()));
+
+  GL_CALL(glBindVertexArray(m_triangleVAO));
+  GL_CALL(glDrawArraysInstanced(GL_TRIANGLES, 0, 3,
+                                static_cast<GLsizei>(m_instanceModels.size())));
+}
+
+void OpenGLRenderer::drawCustomTriangles(size_t begin, size_t end) {
+  // Fallback: one upload and draw per custom triangle
+  const auto &commands = m_queue.commands();
+  GL_CALL(glBindVertexArray(VAO));
+  GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, VBO));
+  for (size_t i = begin; i < end; ++i) {
+    const uint32_t index = commands[i].index;
+    const auto &triangle =
+        Entity::getComponentManager()->getComponent<CTriangle>(
+            m_modelSources[index]);
+    GL_CALL(glBufferData(
+        GL_ARRAY_BUFFER,
+        EngineConstants::Graphics::TRIANGLE_VERTEX_DATA_SIZE * sizeof(float),
+        triangle.vertices.data(), GL_DYNAMIC_DRAW));
+    m_colorShader->setMat4(m_colorModelLoc, m_models[index]);
+    GL_CALL(glDrawArrays(GL_TRIANGLES, 0, 3));
+  }
+}
+
+void OpenGLRenderer::setStaticLines(const LineBatch &lines) {
+  m_staticLines = lines;
+  m_staticLinesDirty = true;
+}
+
+void OpenGLRenderer::drawLine(const glm::vec3 &start, const glm::vec3 &end,
+                              const glm::vec3 &color, float width) {
+  m_frameLines.addLine(start, end, color, width);
+}
+
+void OpenGLRenderer::renderLines(const EntityVec &entities) {
+  // CGridLine entities join this frame's batch; their transform only translates
   for (const auto &e : entities) {
     if (e->has<CGridLine>() && e->has<CTransform3D>()) {
       auto &gridLine = e->get<CGridLine>();
       auto &transform = e->get<CTransform3D>();
-      
-      // Create line vertices (start and end points with color)
-      std::vector<float> lineVertices = {
-        // Position (3) + Color (3)
-        gridLine.start.x, gridLine.start.y, gridLine.start.z, gridLine.color.r, gridLine.color.g, gridLine.color.b,
-        gridLine.end.x,   gridLine.end.y,   gridLine.end.z,   gridLine.color.r, gridLine.color.g, gridLine.color.b
-      };
-      
-      // Update buffer with line data
-      GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, VBO));
-      GL_CALL(glBufferData(GL_ARRAY_BUFFER, lineVertices.size() * sizeof(float), 
-                           lineVertices.data(), GL_DYNAMIC_DRAW));
-      
-      // Set up model matrix (identity for grid lines since they're in world space)
-      glm::mat4 model = glm::mat4(1.0f);
-      model = glm::translate(model, transform.position);
-      
-      // Update uniforms
-      GLint modelLoc = glGetUniformLocation(shaderProgram, "model");
-      GLint viewLoc = glGetUniformLocation(shaderProgram, "view");
-      GLint projLoc = glGetUniformLocation(shaderProgram, "projection");
-      
-      GL_CALL(glad_glUniformMatrix4fv(modelLoc, 1, GL_FALSE, glm::value_ptr(model)));
-      GL_CALL(glad_glUniformMatrix4fv(viewLoc, 1, GL_FALSE, glm::value_ptr(view)));
-      GL_CALL(glad_glUniformMatrix4fv(projLoc, 1, GL_FALSE, glm::value_ptr(projection)));
-      
-      // Set line width (note: this may not work on all OpenGL implementations)
-      GL_CALL(glLineWidth(gridLine.width * 100.0f)); // Scale up for visibility
-      
-      // Draw the line
-      GL_CALL(glDrawArrays(GL_LINES, 0, 2));
+      m_frameLines.addLine(
+          gridLine.start + transform.position, gridLine.end + transform.position,
+          gridLine.color,
+          gridLine.width * EngineConstants::Graphics::LINE_WIDTH_PIXELS_PER_UNIT);
     }
   }
-  
+  if (m_staticLines.empty() && m_frameLines.empty() && !m_staticLinesDirty) {
+    return;
+  }
+
+  // Lines are already in world space
+  m_colorShader->use();
+  m_colorShader->setMat4(m_colorModelLoc, glm::mat4(1.0f));
+
+  GL_CALL(glBindVertexArray(m_staticLineVAO));
+  if (m_staticLinesDirty) {
+    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, m_staticLineVBO));
+    GL_CALL(glBufferData(GL_ARRAY_BUFFER,
+                         m_staticLines.vertices().size() * sizeof(float),
+                         m_staticLines.vertices().data(), GL_STATIC_DRAW));
+    m_staticLinesDirty = false;
+  }
+  drawLineRuns(m_staticLines);
+
+  if (!m_frameLines.empty()) {
+    // Orphan last frame's storage rather than waiting for it
+    GL_CALL(glBindVertexArray(VAO));
+    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, VBO));
+    GL_CALL(glBufferData(GL_ARRAY_BUFFER,
+                         m_frameLines.vertices().size() * sizeof(float),
+                         m_frameLines.vertices().data(), GL_STREAM_DRAW));
+    drawLineRuns(m_frameLines);
+    m_frameLines.clear();
+  }
+}
+
+void OpenGLRenderer::drawLineRuns(const LineBatch &lines) {
+  if (lines.empty()) {
+    return;
+  }
+  // Note: widths other than 1 may not be supported on all OpenGL implementations
+  for (const auto &run : lines.runs()) {
+    GL_CALL(glLineWidth(run.width));
+    GL_CALL(glDrawArrays(GL_LINES, static_cast<GLint>(run.firstVertex),
+                         static_cast<GLsizei>(run.vertexCount)));
+  }
   // Reset line width
   GL_CALL(glLineWidth(1.0f));
 }
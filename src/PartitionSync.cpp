@@ -0,0 +1,45 @@
+#include "../include/PartitionSync.hpp"
+
+PartitionSync::PartitionSync(SpatialPartitionStrategy& partition, const EntityManager& entityManager)
+    : m_partition(partition), m_entityManager(&entityManager) {}
+
+std::shared_ptr<PartitionSync> PartitionSync::attach(SpatialPartitionStrategy& partition,
+                                                     EntityManager& entityManager) {
+    std::shared_ptr<PartitionSync> sync(new PartitionSync(partition, entityManager));
+    partition.clear();
+
+    // Entities added before we subscribed are already live
+    for (const auto& entity : entityManager.getEntities()) {
+        sync->entry(entity->id()).live = true;
+    }
+    entityManager.addListener(sync);
+    return sync;
+}
+
+PartitionSync::Entry& PartitionSync::entry(size_t entityID) {
+    if (entityID >= m_entries.size()) {
+        m_entries.resize(entityID + 1);
+    }
+    return m_entries[entityID];
+}
+
+void PartitionSync::unregister(size_t entityID) {
+    Entry& e = m_entries[entityID];
+    if (e.registered) {
+        m_partition.remove(entityID);
+        e.registered = false;
+        m_registeredCount--;
+    }
+}
+
+void PartitionSync::onEntityAdded(Entity& entity) {
+    // Registered on the next sync(), once its bounds are computed
+    entry(entity.id()).live = true;
+}
+
+void PartitionSync::onEntityRemoved(Entity& entity) {
+    // The slot ID may be reused right away, so drop the registration now
+    Entry& e = entry(entity.id());
+    unregister(entity.id());
+    e.live = false;
+}
@@ -0,0 +1,40 @@
+#include "../include/RenderQueue.hpp"
+#include <array>
+#include <utility>
+
+void RenderQueue::sort() {
+    m_lastSortPasses = 0;
+    const size_t count = m_commands.size();
+    if (count < 2) {
+        return;
+    }
+
+    // One read of the keys builds the histograms of all eight digits
+    std::array<std::array<uint32_t, 256>, 8> histograms{};
+    for (const RenderCommand& command : m_commands) {
+        for (int digit = 0; digit < 8; ++digit) {
+            histograms[digit][(command.key >> (digit * 8)) & 0xFF]++;
+        }
+    }
+
+    m_scratch.resize(count);
+    for (int digit = 0; digit < 8; ++digit) {
+        auto& histogram = histograms[digit];
+        // Every key has the same byte here: the pass would not move anything
+        if (histogram[(m_commands[0].key >> (digit * 8)) & 0xFF] == count) {
+            continue;
+        }
+
+        uint32_t offset = 0;
+        for (uint32_t& bucket : histogram) {
+            uint32_t bucketCount = bucket;
+            bucket = offset;
+            offset += bucketCount;
+        }
+        for (const RenderCommand& command : m_commands) {
+            m_scratch[histogram[(command.key >> (digit * 8)) & 0xFF]++] = command;
+        }
+        std::swap(m_commands, m_scratch);
+        m_lastSortPasses++;
+    }
+}
@@ -3,7 +3,18 @@
 #include <SFML/Graphics/Drawable.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
 
-SFMLRenderer::SFMLRenderer(sf::RenderWindow &window) : m_window(window){};
+namespace {
+constexpr float VERTEX_DOT_RADIUS = 2.0f;
+} // namespace
+
+SFMLRenderer::SFMLRenderer(sf::RenderWindow &window) : m_window(window) {
+  // Same geometry the per-vertex sf::CircleShape dots had
+  sf::CircleShape dot(VERTEX_DOT_RADIUS);
+  for (size_t i = 0; i < dot.getPointCount(); ++i) {
+    m_circlePoints.push_back(dot.getPoint(i));
+  }
+  ShapeBatch::triangulate(m_circlePoints, 0.0f, m_dotTriangles, m_circleOutline);
+};
 SFMLRenderer::~SFMLRenderer(){};
 
 void SFMLRenderer::render() {
@@ -13,13 +24,25 @@ void SFMLRenderer::render() {
 void SFMLRenderer::init() {};
 
 void SFMLRenderer::render(const EntityVec &entities) {
-  for (auto &e : entities) {
+  m_queue.clear();
+  for (size_t i = 0; i < entities.size(); ++i) {
+    const auto &e = entities[i];
+    if (e->has<CShape>() || e->has<CComplexShape>()) {
+      m_queue.submit(RenderQueue::makeKey(0, 0, 0, static_cast<uint32_t>(i)),
+                     static_cast<uint32_t>(i));
+    }
+  }
+  m_queue.sort();
+
+  m_batch.clear();
+  for (const RenderCommand &command : m_queue.commands()) {
+    const auto &e = entities[command.index];
     if (e->has<CShape>()) {
       auto transform = e->get<CTransform>();
       auto &shape = e->get<CShape>();
-      e->get<CShape>().circle.setPosition(transform.pos);
-      e->get<CShape>().circle.setRotation(transform.angle);
-      m_window.draw(shape.circle);
+      shape.circle.setPosition(transform.pos);
+      shape.circle.setRotation(transform.angle);
+      appendCircle(shape.circle);
     }
     else if (e->has<CComplexShape>()) {
       auto transform = e->get<CTransform>();
@@ -27,46 +50,55 @@ void SFMLRenderer::render(const EntityVec &entities) {
       
       if (complexShape.type == CComplexShape::POLYGON || 
           complexShape.type == CComplexShape::VORONOI_REGION) {
-        renderPolygon(complexShape, transform);
+        appendPolygon(complexShape, transform);
       }
     }
   }
+  
+  if (!m_batch.empty()) {
+    m_window.draw(m_batch.vertices());
+  }
+}
+
+void SFMLRenderer::appendCircle(const sf::CircleShape &circle) {
+  // Circles are few and may change radius or point count, so they are
+  // triangulated each frame in local space and moved by their transform
+  m_circlePoints.clear();
+  for (size_t i = 0; i < circle.getPointCount(); ++i) {
+    m_circlePoints.push_back(circle.getPoint(i));
+  }
+  ShapeBatch::triangulate(m_circlePoints, circle.getOutlineThickness(),
+                          m_circleFill, m_circleOutline);
+  const sf::Transform transform = circle.getTransform();
+  m_batch.append(m_circleFill, circle.getFillColor(), transform);
+  m_batch.append(m_circleOutline, circle.getOutlineColor(), transform);
 }
 
-void SFMLRenderer::renderPolygon(const CComplexShape& complexShape, const CTransform& transform) {
+void SFMLRenderer::appendPolygon(CComplexShape &complexShape, const CTransform &transform) {
   if (complexShape.vertices.empty()) return;
   
-  sf::ConvexShape polygon = createPolygonShape(complexShape.vertices);
-  
-  // Apply colors and styling
-  polygon.setFillColor(complexShape.fillColor);
-  polygon.setOutlineColor(complexShape.outlineColor);
-  polygon.setOutlineThickness(complexShape.outlineThickness);
-  
-  // Apply transform (note: polygon vertices are already in world coordinates)
-  polygon.setPosition(0, 0); // Don't offset, vertices are already positioned
-  polygon.setRotation(transform.angle);
+  // Rebuilt only when the vertices or outline thickness changed; colors
+  // are applied as the cached triangles are appended
+  complexShape.updateTriangulation();
   
-  m_window.draw(polygon);
+  // Polygon vertices are already in world coordinates; the angle rotates
+  // about the world origin, as sf::Shape::setRotation did
+  if (transform.angle == 0.0f) {
+    m_batch.append(complexShape.fillTriangles, complexShape.fillColor);
+    m_batch.append(complexShape.outlineTriangles, complexShape.outlineColor);
+  } else {
+    sf::Transform rotation;
+    rotation.rotate(transform.angle);
+    m_batch.append(complexShape.fillTriangles, complexShape.fillColor, rotation);
+    m_batch.append(complexShape.outlineTriangles, complexShape.outlineColor, rotation);
+  }
   
   // Debug: draw vertices if enabled
   if (complexShape.showVertices) {
     for (const auto& vertex : complexShape.vertices) {
-      sf::CircleShape dot(2.0f);
-      dot.setFillColor(sf::Color::Red);
-      dot.setPosition(vertex.x - 2.0f, vertex.y - 2.0f);
-      m_window.draw(dot);
+      sf::Transform offset;
+      offset.translate(vertex.x - VERTEX_DOT_RADIUS, vertex.y - VERTEX_DOT_RADIUS);
+      m_batch.append(m_dotTriangles, sf::Color::Red, offset);
     }
   }
 }
-
-sf::ConvexShape SFMLRenderer::createPolygonShape(const std::vector<Vec2f>& vertices) {
-  sf::ConvexShape polygon;
-  polygon.setPointCount(vertices.size());
-  
-  for (size_t i = 0; i < vertices.size(); ++i) {
-    polygon.setPoint(i, sf::Vector2f(vertices[i].x, vertices[i].y));
-  }
-  
-  return polygon;
-}
@@ -0,0 +1,136 @@
+#include "../include/ShaderProgram.hpp"
+#include "../include/Constants.hpp"
+#include "../include/FileLoader.h"
+#include "../include/Logger.hpp"
+#include <glm/gtc/type_ptr.hpp>
+#include <vector>
+
+ShaderProgram::ShaderProgram(const std::string &name, const char *vertexSource,
+                             const char *fragmentSource)
+    : m_name(name) {
+  unsigned int vertexShader = compileShader(vertexSource, GL_VERTEX_SHADER);
+  unsigned int fragmentShader =
+      compileShader(fragmentSource, GL_FRAGMENT_SHADER);
+
+  m_id = glCreateProgram();
+  GL_CHECK_ERROR();
+  GL_CALL(glAttachShader(m_id, vertexShader));
+  GL_CALL(glAttachShader(m_id, fragmentShader));
+  GL_CALL(glLinkProgram(m_id));
+
+  // check for linking errors
+  int success;
+  GL_CALL(glGetProgramiv(m_id, GL_LINK_STATUS, &success));
+  if (!success) {
+    char infoLog[EngineConstants::Graphics::SHADER_LOG_BUFFER_SIZE];
+    GL_CALL(glGetProgramInfoLog(
+        m_id, EngineConstants::Graphics::SHADER_LOG_BUFFER_SIZE, nullptr,
+        infoLog));
+    LOG_ERROR_STREAM("ShaderProgram: Linking '" << m_name << "' failed:\n"
+                                                << infoLog);
+  }
+  m_linked = success;
+
+  GL_CALL(glDeleteShader(vertexShader));
+  GL_CALL(glDeleteShader(fragmentShader));
+
+  if (m_linked) {
+    cacheUniforms();
+  }
+}
+
+ShaderProgram::~ShaderProgram() {
+  if (m_id != 0) {
+    GL_CALL(glDeleteProgram(m_id));
+  }
+}
+
+void ShaderProgram::use() const { GL_CALL(glUseProgram(m_id)); }
+
+GLint ShaderProgram::uniformLocation(const std::string &uniform) const {
+  auto it = m_uniforms.find(uniform);
+  return it != m_uniforms.end() ? it->second : -1;
+}
+
+void ShaderProgram::setMat4(GLint location, const glm::mat4 &value) const {
+  GL_CALL(glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(value)));
+}
+
+void ShaderProgram::bindUniformBlock(const std::string &block,
+                                     GLuint bindingPoint) const {
+  GLuint index = glGetUniformBlockIndex(m_id, block.c_str());
+  GL_CHECK_ERROR();
+  if (index != GL_INVALID_INDEX) {
+    GL_CALL(glUniformBlockBinding(m_id, index, bindingPoint));
+  }
+}
+
+unsigned int ShaderProgram::compileShader(const char *source, GLenum type) {
+  unsigned int shader = glCreateShader(type);
+  GL_CHECK_ERROR();
+  GL_CALL(glShaderSource(shader, 1, &source, nullptr));
+  GL_CALL(glCompileShader(shader));
+
+  int success;
+  GL_CALL(glGetShaderiv(shader, GL_COMPILE_STATUS, &success));
+  if (!success) {
+    char infoLog[EngineConstants::Graphics::SHADER_LOG_BUFFER_SIZE];
+    GL_CALL(glGetShaderInfoLog(
+        shader, EngineConstants::Graphics::SHADER_LOG_BUFFER_SIZE, nullptr,
+        infoLog));
+    LOG_ERROR_STREAM("ShaderProgram: Compiling '" << m_name << "' ("
+                     << (type == GL_VERTEX_SHADER ? "vertex" : "fragment")
+                     << ") failed:\n" << infoLog);
+  }
+  return shader;
+}
+
+void ShaderProgram::cacheUniforms() {
+  GLint count = 0;
+  GLint maxLength = 0;
+  GL_CALL(glGetProgramiv(m_id, GL_ACTIVE_UNIFORMS, &count));
+  GL_CALL(glGetProgramiv(m_id, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength));
+  std::vector<char> buffer(static_cast<size_t>(maxLength) + 1);
+  for (GLint i = 0; i < count; ++i) {
+    GLsizei length = 0;
+    GLint size = 0;
+    GLenum type = 0;
+    GL_CALL(glGetActiveUniform(m_id, static_cast<GLuint>(i), maxLength,
+                               &length, &size, &type, buffer.data()));
+    std::string uniform(buffer.data(), static_cast<size_t>(length));
+    GLint location = glGetUniformLocation(m_id, uniform.c_str());
+    GL_CHECK_ERROR();
+    if (location < 0) {
+      continue; // Uniform block member: set through its buffer
+    }
+    // Arrays are reported as "name[0]"; look them up by their plain name
+    const std::string arraySuffix = "[0]";
+    if (uniform.size() > arraySuffix.size() &&
+        uniform.compare(uniform.size() - arraySuffix.size(),
+                        arraySuffix.size(), arraySuffix) == 0) {
+      uniform.resize(uniform.size() - arraySuffix.size());
+    }
+    m_uniforms[uniform] = location;
+  }
+  LOG_DEBUG_STREAM("ShaderProgram: '" << m_name << "' linked with "
+                   << m_uniforms.size() << " uniforms");
+}
+
+ShaderProgram &ShaderRegistry::load(const std::string &name,
+                                    const std::string &vertexPath,
+                                    const std::string &fragmentPath) {
+  std::string vertexSource = FileLoader::loadFileAsString(vertexPath);
+  std::string fragmentSource = FileLoader::loadFileAsString(fragmentPath);
+  auto program = std::make_unique<ShaderProgram>(name, vertexSource.c_str(),
+                                                 fragmentSource.c_str());
+  ShaderProgram &result = *program;
+  m_programs[name] = std::move(program);
+  LOG_INFO_STREAM("ShaderRegistry: Loaded '" << name << "' from "
+                  << vertexPath << " + " << fragmentPath);
+  return result;
+}
+
+ShaderProgram *ShaderRegistry::get(const std::string &name) const {
+  auto it = m_programs.find(name);
+  return it != m_programs.end() ? it->second.get() : nullptr;
+}
@@ -1,9 +1,13 @@
 #include "../include/SpatialPartition.hpp"
+#include "../include/AABBBatch.hpp"
 #include "../include/Constants.hpp"
+#include "../include/JobSystem.hpp"
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <iostream>
-#include <unordered_set>
+#include <limits>
+#include <unordered_map>
 
 // ============================================================================
 // AABBUtils Implementation
@@ -45,6 +49,7 @@ CAABB AABBUtils::getWorldAABB(const std::shared_ptr<Entity>& entity) {
  * - Simple and fast O(1) insertion/lookup
  * - Great for evenly distributed entities
  * - Predictable memory usage
+ * - findCollisions splits by row chunks across a JobSystem, same pair order
  * 
  * Cons:
  * - Poor for clustered entities (many empty cells)
@@ -54,24 +59,20 @@ CAABB AABBUtils::getWorldAABB(const std::shared_ptr<Entity>& entity) {
 class UniformGridStrategy : public SpatialPartitionStrategy {
 private:
     struct GridCell {
-        std::vector<EntityID> entities;
-        
-        void addEntity(EntityID id) {
-            entities.push_back(id);
-        }
-        
-        void removeEntity(EntityID id) {
-            auto it = std::find(entities.begin(), entities.end(), id);
-            if (it != entities.end()) {
-                entities.erase(it);
-            }
-        }
+        std::vector<uint32_t> entities; // Dense entity indices
         
         bool isEmpty() const {
             return entities.empty();
         }
     };
     
+    struct EntityRecord {
+        EntityID id;
+        CAABB bounds;
+        glm::ivec3 minCell; // Unclamped; may lie outside the grid
+        glm::ivec3 maxCell;
+    };
+    
     // Grid configuration
     glm::vec3 m_worldMin;
     glm::vec3 m_worldMax;
@@ -81,7 +82,21 @@ private:
     
     // Grid storage
     std::vector<GridCell> m_grid;
-    std::unordered_map<EntityID, CAABB> m_entityBounds; // Track entity positions for updates
+    std::vector<EntityRecord> m_entities;
+    std::unordered_map<EntityID, uint32_t> m_entityIndex; // Only used by insert/remove/update
+    
+    // Per-entity stamp for duplicate-free queries without a hash set
+    mutable std::vector<uint32_t> m_queryStamp;
+    mutable uint32_t m_currentStamp = 0;
+    
+    // SoA copy of the current cell's bounds for the batched overlap kernel
+    mutable AABBBatch m_cellBatch;
+    
+    // Parallel findCollisions: one batch per thread, one pair buffer per row chunk
+    JobSystem* m_jobs = nullptr;
+    mutable std::vector<AABBBatch> m_threadBatches;
+    mutable std::vector<std::vector<CollisionPair>> m_chunkPairs;
+    mutable std::vector<size_t> m_chunkChecks;
     
     // Performance tracking
     mutable PartitionStats m_stats;
@@ -116,176 +131,279 @@ public:
         );
     }
     
-    // Convert grid coordinates to grid index
-    size_t gridToIndex(const glm::ivec3& gridPos) const {
-        // Clamp to valid range
-        glm::ivec3 clamped = glm::clamp(gridPos, glm::ivec3(0), m_gridDimensions - 1);
-        return clamped.z * m_gridDimensions.x * m_gridDimensions.y + 
-               clamped.y * m_gridDimensions.x + 
-               clamped.x;
+    // Convert grid index back to grid coordinates
+    glm::ivec3 indexToGrid(size_t cellIndex) const {
+        int x = static_cast<int>(cellIndex % m_gridDimensions.x);
+        size_t rest = cellIndex / m_gridDimensions.x;
+        return glm::ivec3(x, static_cast<int>(rest % m_gridDimensions.y),
+                          static_cast<int>(rest / m_gridDimensions.y));
     }
     
-    // Check if grid coordinates are valid
-    bool isValidGridPos(const glm::ivec3& gridPos) const {
-        return gridPos.x >= 0 && gridPos.x < m_gridDimensions.x &&
-               gridPos.y >= 0 && gridPos.y < m_gridDimensions.y &&
-               gridPos.z >= 0 && gridPos.z < m_gridDimensions.z;
+    // Visit the index of every valid grid cell in [minCell, maxCell] (cells outside the grid are skipped)
+    template<typename Fn>
+    void forEachCell(const glm::ivec3& minCell, const glm::ivec3& maxCell, Fn&& fn) const {
+        glm::ivec3 lo = glm::max(minCell, glm::ivec3(0));
+        glm::ivec3 hi = glm::min(maxCell, m_gridDimensions - 1);
+        for (int z = lo.z; z <= hi.z; ++z) {
+            for (int y = lo.y; y <= hi.y; ++y) {
+                size_t rowStart = (static_cast<size_t>(z) * m_gridDimensions.y + y) * m_gridDimensions.x;
+                for (int x = lo.x; x <= hi.x; ++x) {
+                    fn(rowStart + x);
+                }
+            }
+        }
     }
     
-    // Get all grid cells that an AABB overlaps
-    std::vector<size_t> getOverlappingCells(const CAABB& bounds) const {
-        std::vector<size_t> cells;
-        
-        glm::ivec3 minGrid = worldToGrid(bounds.min);
-        glm::ivec3 maxGrid = worldToGrid(bounds.max);
-        
-        for (int z = minGrid.z; z <= maxGrid.z; ++z) {
-            for (int y = minGrid.y; y <= maxGrid.y; ++y) {
-                for (int x = minGrid.x; x <= maxGrid.x; ++x) {
-                    glm::ivec3 gridPos(x, y, z);
-                    if (isValidGridPos(gridPos)) {
-                        cells.push_back(gridToIndex(gridPos));
-                    }
-                }
+    void addToCells(uint32_t entityIndex, const glm::ivec3& minCell, const glm::ivec3& maxCell) {
+        forEachCell(minCell, maxCell, [&](size_t cellIndex) {
+            m_grid[cellIndex].entities.push_back(entityIndex);
+        });
+    }
+    
+    void removeFromCells(uint32_t entityIndex, const glm::ivec3& minCell, const glm::ivec3& maxCell) {
+        forEachCell(minCell, maxCell, [&](size_t cellIndex) {
+            auto& entities = m_grid[cellIndex].entities;
+            auto it = std::find(entities.begin(), entities.end(), entityIndex);
+            if (it != entities.end()) {
+                *it = entities.back();
+                entities.pop_back();
             }
+        });
+    }
+    
+    uint32_t nextQueryStamp() const {
+        m_queryStamp.resize(m_entities.size(), 0);
+        if (++m_currentStamp == 0) {
+            std::fill(m_queryStamp.begin(), m_queryStamp.end(), 0);
+            m_currentStamp = 1;
         }
-        
-        return cells;
+        return m_currentStamp;
     }
     
     void insert(EntityID entityId, const CAABB& bounds) override {
-        // Store entity bounds for future updates
-        m_entityBounds[entityId] = bounds;
-        
-        // Insert into all overlapping cells
-        auto cells = getOverlappingCells(bounds);
-        for (size_t cellIndex : cells) {
-            m_grid[cellIndex].addEntity(entityId);
+        if (m_entityIndex.find(entityId) != m_entityIndex.end()) {
+            update(entityId, bounds);
+            return;
         }
+        
+        uint32_t entityIndex = static_cast<uint32_t>(m_entities.size());
+        EntityRecord record{entityId, bounds, worldToGrid(bounds.min), worldToGrid(bounds.max)};
+        m_entities.push_back(record);
+        m_entityIndex[entityId] = entityIndex;
+        addToCells(entityIndex, record.minCell, record.maxCell);
     }
     
     void remove(EntityID entityId) override {
-        auto it = m_entityBounds.find(entityId);
-        if (it == m_entityBounds.end()) {
+        auto it = m_entityIndex.find(entityId);
+        if (it == m_entityIndex.end()) {
             return; // Entity not found
         }
         
-        // Remove from all cells it was in
-        auto cells = getOverlappingCells(it->second);
-        for (size_t cellIndex : cells) {
-            m_grid[cellIndex].removeEntity(entityId);
-        }
+        uint32_t entityIndex = it->second;
+        removeFromCells(entityIndex, m_entities[entityIndex].minCell, m_entities[entityIndex].maxCell);
+        m_entityIndex.erase(it);
         
-        m_entityBounds.erase(it);
+        // Swap-remove from dense entity array, renumbering the moved entity in its cells
+        uint32_t last = static_cast<uint32_t>(m_entities.size() - 1);
+        if (entityIndex != last) {
+            const EntityRecord& moved = m_entities[last];
+            forEachCell(moved.minCell, moved.maxCell, [&](size_t cellIndex) {
+                auto& entities = m_grid[cellIndex].entities;
+                std::replace(entities.begin(), entities.end(), last, entityIndex);
+            });
+            m_entityIndex[moved.id] = entityIndex;
+            m_entities[entityIndex] = moved;
+        }
+        m_entities.pop_back();
     }
     
     void update(EntityID entityId, const CAABB& newBounds) override {
-        auto it = m_entityBounds.find(entityId);
-        if (it == m_entityBounds.end()) {
+        auto it = m_entityIndex.find(entityId);
+        if (it == m_entityIndex.end()) {
             // Entity not found, just insert
             insert(entityId, newBounds);
             return;
         }
         
-        const CAABB& oldBounds = it->second;
-        
-        // Check if entity moved to different cells
-        auto oldCells = getOverlappingCells(oldBounds);
-        auto newCells = getOverlappingCells(newBounds);
+        EntityRecord& record = m_entities[it->second];
+        glm::ivec3 newMin = worldToGrid(newBounds.min);
+        glm::ivec3 newMax = worldToGrid(newBounds.max);
+        record.bounds = newBounds;
         
-        // Remove from old cells that are no longer overlapped
-        for (size_t oldCell : oldCells) {
-            if (std::find(newCells.begin(), newCells.end(), oldCell) == newCells.end()) {
-                m_grid[oldCell].removeEntity(entityId);
-            }
+        // Same cell range: only the stored bounds change (common for small moves)
+        if (newMin == record.minCell && newMax == record.maxCell) {
+            return;
         }
         
-        // Add to new cells that weren't previously overlapped
-        for (size_t newCell : newCells) {
-            if (std::find(oldCells.begin(), oldCells.end(), newCell) == oldCells.end()) {
-                m_grid[newCell].addEntity(entityId);
-            }
-        }
+        uint32_t entityIndex = it->second;
+        glm::ivec3 oldMin = record.minCell;
+        glm::ivec3 oldMax = record.maxCell;
+        record.minCell = newMin;
+        record.maxCell = newMax;
         
-        // Update stored bounds
-        it->second = newBounds;
+        // Leave cells no longer covered, join newly covered ones
+        auto covers = [this](size_t cellIndex, const glm::ivec3& lo, const glm::ivec3& hi) {
+            glm::ivec3 cell = indexToGrid(cellIndex);
+            return cell.x >= lo.x && cell.x <= hi.x && cell.y >= lo.y && cell.y <= hi.y &&
+                   cell.z >= lo.z && cell.z <= hi.z;
+        };
+        forEachCell(oldMin, oldMax, [&](size_t cellIndex) {
+            if (!covers(cellIndex, newMin, newMax)) {
+                auto& entities = m_grid[cellIndex].entities;
+                auto found = std::find(entities.begin(), entities.end(), entityIndex);
+                if (found != entities.end()) {
+                    *found = entities.back();
+                    entities.pop_back();
+                }
+            }
+        });
+        forEachCell(newMin, newMax, [&](size_t cellIndex) {
+            if (!covers(cellIndex, oldMin, oldMax)) {
+                m_grid[cellIndex].entities.push_back(entityIndex);
+            }
+        });
     }
     
     void clear() override {
         for (auto& cell : m_grid) {
             cell.entities.clear();
         }
-        m_entityBounds.clear();
+        m_entities.clear();
+        m_entityIndex.clear();
     }
     
-    std::vector<EntityID> query(const CAABB& region) const override {
-        std::unordered_set<EntityID> result;
+    void query(const CAABB& region, std::vector<EntityID>& out) const override {
+        out.clear();
+        if (m_entities.empty()) {
+            return;
+        }
         
-        auto cells = getOverlappingCells(region);
-        for (size_t cellIndex : cells) {
-            const auto& cell = m_grid[cellIndex];
-            for (EntityID entityId : cell.entities) {
-                result.insert(entityId);
+        uint32_t stamp = nextQueryStamp();
+        forEachCell(worldToGrid(region.min), worldToGrid(region.max), [&](size_t cellIndex) {
+            for (uint32_t entityIndex : m_grid[cellIndex].entities) {
+                if (m_queryStamp[entityIndex] != stamp) {
+                    m_queryStamp[entityIndex] = stamp;
+                    out.push_back(m_entities[entityIndex].id);
+                }
             }
+        });
+    }
+    
+    std::vector<EntityID> query(const CAABB& region) const override {
+        std::vector<EntityID> result;
+        query(region, result);
+        return result;
+    }
+    
+    /**
+     * Append the pairs first reported by one cell to out
+     * @return Number of pair tests performed
+     */
+    size_t collideCell(int x, int y, int z, AABBBatch& batch, std::vector<CollisionPair>& out) const {
+        const auto& cell = m_grid[(static_cast<size_t>(z) * m_gridDimensions.y + y) * m_gridDimensions.x + x];
+        const size_t count = cell.entities.size();
+        if (count < EngineConstants::SpatialPartition::MIN_ENTITIES_FOR_COLLISION) {
+            return 0;
         }
         
-        return std::vector<EntityID>(result.begin(), result.end());
+        // Check all pairs within this cell, BATCH_WIDTH candidates at a time
+        size_t checks = 0;
+        batch.clear();
+        for (uint32_t entityIndex : cell.entities) {
+            batch.push_back(m_entities[entityIndex].bounds);
+        }
+        for (size_t i = 0; i < count; ++i) {
+            const EntityRecord& a = m_entities[cell.entities[i]];
+            checks += count - i - 1;
+            for (size_t block = i + 1; block < count; block += AABBBatch::BATCH_WIDTH) {
+                uint32_t mask = batch.overlapMask(a.bounds, block);
+                while (mask != 0) {
+                    const EntityRecord& b = m_entities[cell.entities[block + AABBBatch::lowestLane(mask)]];
+                    mask &= mask - 1;
+                    // Report only from the first shared cell (the overlap's min corner,
+                    // clamped into the grid), so pairs spanning cells need no dedup set
+                    if (std::max(std::max(a.minCell.x, b.minCell.x), 0) == x &&
+                        std::max(std::max(a.minCell.y, b.minCell.y), 0) == y &&
+                        std::max(std::max(a.minCell.z, b.minCell.z), 0) == z) {
+                        out.emplace_back(a.id, b.id);
+                    }
+                }
+            }
+        }
+        return checks;
     }
     
-    std::vector<CollisionPair> findCollisions() const override {
-        auto start = std::chrono::high_resolution_clock::now();
-        
-        std::vector<CollisionPair> collisions;
-        
-        // Custom hash function for std::pair<EntityID, EntityID>
-        struct PairHash {
-            std::size_t operator()(const std::pair<EntityID, EntityID>& p) const {
-                return std::hash<EntityID>{}(p.first) ^ (std::hash<EntityID>{}(p.second) << 1);
+    /**
+     * Collide grid rows [firstRow, endRow), where row = z * dimY + y
+     * @return Number of pair tests performed
+     */
+    size_t collideRows(size_t firstRow, size_t endRow, AABBBatch& batch, std::vector<CollisionPair>& out) const {
+        size_t checks = 0;
+        for (size_t row = firstRow; row < endRow; ++row) {
+            int y = static_cast<int>(row % m_gridDimensions.y);
+            int z = static_cast<int>(row / m_gridDimensions.y);
+            for (int x = 0; x < m_gridDimensions.x; ++x) {
+                checks += collideCell(x, y, z, batch, out);
             }
-        };
-        
-        std::unordered_set<std::pair<EntityID, EntityID>, PairHash> processedPairs;
+        }
+        return checks;
+    }
+    
+    void setJobSystem(JobSystem* jobs) override {
+        m_jobs = jobs;
+    }
+    
+    void findCollisions(std::vector<CollisionPair>& out) const override {
+        auto start = std::chrono::high_resolution_clock::now();
         
+        out.clear();
         size_t totalChecks = 0;
+        size_t rowCount = static_cast<size_t>(m_gridDimensions.y) * m_gridDimensions.z;
         
-        // Check each non-empty cell
-        for (const auto& cell : m_grid) {
-            if (cell.entities.size() < EngineConstants::SpatialPartition::MIN_ENTITIES_FOR_COLLISION) continue;
+        if (m_jobs == nullptr || m_jobs->getThreadCount() < 2 ||
+            m_entities.size() < static_cast<size_t>(EngineConstants::SpatialPartition::PARALLEL_MIN_ENTITIES)) {
+            totalChecks = collideRows(0, rowCount, m_cellBatch, out);
+        } else {
+            // Contiguous row chunks, each into its own buffer; concatenating the
+            // buffers in chunk order reproduces the single-threaded pair order
+            size_t threadCount = m_jobs->getThreadCount();
+            size_t chunkCount = std::min(rowCount,
+                threadCount * EngineConstants::SpatialPartition::PARALLEL_CHUNKS_PER_THREAD);
+            if (m_threadBatches.size() < threadCount) {
+                m_threadBatches.resize(threadCount);
+            }
+            if (m_chunkPairs.size() < chunkCount) {
+                m_chunkPairs.resize(chunkCount);
+                m_chunkChecks.resize(chunkCount);
+            }
             
-            // Check all pairs within this cell
-            for (size_t i = 0; i < cell.entities.size(); ++i) {
-                for (size_t j = i + 1; j < cell.entities.size(); ++j) {
-                    EntityID entityA = cell.entities[i];
-                    EntityID entityB = cell.entities[j];
-                    
-                    // Create consistent pair ordering
-                    auto pair = std::make_pair(std::min(entityA, entityB), 
-                                             std::max(entityA, entityB));
-                    
-                    // Skip if we've already checked this pair
-                    if (processedPairs.find(pair) != processedPairs.end()) {
-                        continue;
-                    }
-                    processedPairs.insert(pair);
-                    
-                    // Get entity bounds and check for actual collision
-                    auto boundsA = m_entityBounds.find(entityA);
-                    auto boundsB = m_entityBounds.find(entityB);
-                    
-                    if (boundsA != m_entityBounds.end() && boundsB != m_entityBounds.end()) {
-                        totalChecks++;
-                        if (AABBUtils::intersects(boundsA->second, boundsB->second)) {
-                            collisions.emplace_back(entityA, entityB);
-                        }
-                    }
-                }
+            m_jobs->parallelFor(chunkCount, [&](size_t chunk, size_t thread) {
+                auto& pairs = m_chunkPairs[chunk];
+                pairs.clear();
+                m_chunkChecks[chunk] = collideRows(chunk * rowCount / chunkCount,
+                                                   (chunk + 1) * rowCount / chunkCount,
+                                                   m_threadBatches[thread], pairs);
+            });
+            
+            size_t totalPairs = 0;
+            for (size_t chunk = 0; chunk < chunkCount; ++chunk) {
+                totalPairs += m_chunkPairs[chunk].size();
+                totalChecks += m_chunkChecks[chunk];
+            }
+            out.reserve(totalPairs);
+            for (size_t chunk = 0; chunk < chunkCount; ++chunk) {
+                out.insert(out.end(), m_chunkPairs[chunk].begin(), m_chunkPairs[chunk].end());
             }
         }
         
         auto end = std::chrono::high_resolution_clock::now();
         m_stats.lastQueryTimeMs = std::chrono::duration<double, std::milli>(end - start).count();
         m_stats.totalCollisionChecks = totalChecks;
-        
+    }
+    
+    std::vector<CollisionPair> findCollisions() const override {
+        std::vector<CollisionPair> collisions;
+        findCollisions(collisions);
         return collisions;
     }
     
@@ -296,22 +414,16 @@ public:
         queryRegion.min = point - radiusVec;
         queryRegion.max = point + radiusVec;
         
-        // Get potential entities from grid
-        auto candidates = query(queryRegion);
-        
-        // Filter by actual distance
+        // Filter candidates by actual distance
         std::vector<EntityID> result;
         float radiusSquared = radius * radius;
         
-        for (EntityID entityId : candidates) {
-            auto it = m_entityBounds.find(entityId);
-            if (it != m_entityBounds.end()) {
-                glm::vec3 entityCenter = AABBUtils::getCenter(it->second);
-                glm::vec3 diff = entityCenter - point;
-                float distanceSquared = diff.x * diff.x + diff.y * diff.y + diff.z * diff.z;
-                if (distanceSquared <= radiusSquared) {
-                    result.push_back(entityId);
-                }
+        for (EntityID entityId : query(queryRegion)) {
+            glm::vec3 entityCenter = AABBUtils::getCenter(m_entities[m_entityIndex.at(entityId)].bounds);
+            glm::vec3 diff = entityCenter - point;
+            float distanceSquared = diff.x * diff.x + diff.y * diff.y + diff.z * diff.z;
+            if (distanceSquared <= radiusSquared) {
+                result.push_back(entityId);
             }
         }
         
@@ -322,7 +434,7 @@ public:
         stats = m_stats;
         stats.totalNodes = m_grid.size();
         stats.maxDepth = 1; // Grid has no depth
-        stats.totalEntities = m_entityBounds.size();
+        stats.totalEntities = m_entities.size();
         
         // Calculate empty nodes and entity distribution
         size_t emptyNodes = 0;
@@ -354,23 +466,20 @@ public:
             return false;
         }
         
-        // Check that all entities in bounds map exist in grid
-        for (const auto& pair : m_entityBounds) {
-            EntityID entityId = pair.first;
-            const CAABB& bounds = pair.second;
-            
-            auto cells = getOverlappingCells(bounds);
-            bool foundInGrid = false;
-            
-            for (size_t cellIndex : cells) {
-                const auto& cell = m_grid[cellIndex];
-                if (std::find(cell.entities.begin(), cell.entities.end(), entityId) != cell.entities.end()) {
-                    foundInGrid = true;
-                    break;
-                }
+        // Every entity is indexed and listed in every grid cell it covers
+        for (uint32_t i = 0; i < m_entities.size(); ++i) {
+            const EntityRecord& record = m_entities[i];
+            auto indexIt = m_entityIndex.find(record.id);
+            if (indexIt == m_entityIndex.end() || indexIt->second != i) {
+                return false;
             }
             
-            if (!foundInGrid) {
+            bool listed = true;
+            forEachCell(record.minCell, record.maxCell, [&](size_t cellIndex) {
+                const auto& entities = m_grid[cellIndex].entities;
+                listed = listed && std::find(entities.begin(), entities.end(), i) != entities.end();
+            });
+            if (!listed) {
                 return false;
             }
         }
@@ -380,146 +489,1865 @@ public:
 };
 
 // ============================================================================
-// Future Algorithm Stubs
+// Quadtree Implementation
 // ============================================================================
 
 /**
- * TODO: Quadtree Implementation
+ * Loose Quadtree Spatial Partitioning Strategy
  * 
- * Adaptive 2D spatial partitioning that subdivides space as needed.
- * Excellent for 2D games with non-uniform entity distribution.
+ * Adaptive 2D partitioning on the XY plane (Z is only used for the final
+ * AABB test). Subdivides where entities cluster and leaves empty space as
+ * a single node, so memory follows the entity distribution.
  * 
  * Implementation notes:
- * - Each node has 4 children (NW, NE, SW, SE)
- * - Split when node exceeds capacity (e.g., 8 entities)
- * - Merge when children collectively have few entities
- * - Handle entities that span multiple nodes
+ * - Each node has 4 children (SW, SE, NW, NE), allocated as one block of
+ *   4 consecutive nodes from a pooled node vector with a free list
+ * - Loose bounds: a node accepts any entity whose center lies in its tight
+ *   square and whose half-extent fits within (looseness - 1) * halfSize,
+ *   so every entity lives in exactly one node (no duplicate pairs)
+ * - Split when a leaf exceeds maxEntitiesPerNode, merge children back when
+ *   the subtree drops to maxEntitiesPerNode or fewer
+ * - update() is a bounds refresh while the entity stays inside its node's
+ *   loose bounds; only entities leaving them are reinserted
+ * - The root accepts anything, so entities outside the world are kept
  */
 class QuadtreeStrategy : public SpatialPartitionStrategy {
-public:
-    QuadtreeStrategy(const glm::vec3& worldMin, const glm::vec3& worldMax, size_t maxEntitiesPerNode = EngineConstants::SpatialPartition::QUADTREE_MAX_ENTITIES_PER_NODE) {
-        // TODO: Implement quadtree construction
-        std::cout << "TODO: QuadtreeStrategy not yet implemented" << std::endl;
+private:
+    static constexpr uint32_t INVALID_NODE = UINT32_MAX;
+    
+    struct Item {
+        EntityID id;
+        CAABB bounds;
+    };
+    
+    struct Node {
+        glm::vec2 center;
+        float halfSize = 0.0f;
+        uint32_t parent = INVALID_NODE;
+        uint32_t firstChild = INVALID_NODE; // Children are firstChild..firstChild+3
+        size_t depth = 0;
+        size_t subtreeCount = 0;            // Entities in this node and all descendants
+        std::vector<Item> items;
+        
+        bool isLeaf() const { return firstChild == INVALID_NODE; }
+    };
+    
+    // Tree configuration
+    size_t m_maxEntitiesPerNode;
+    size_t m_maxDepth;
+    float m_minNodeSize;
+    float m_looseness;
+    
+    // Pooled node storage (node 0 is the root)
+    std::vector<Node> m_nodes;
+    std::vector<uint32_t> m_freeBlocks;                  // First index of each free block of 4
+    std::unordered_map<EntityID, uint32_t> m_entityNode; // Entity -> node holding it
+    
+    // Traversal stack for findCollisions (reused between calls)
+    mutable std::vector<uint32_t> m_nodeStack;
+    
+    // Performance tracking
+    mutable PartitionStats m_stats;
+    
+    static bool overlapsXY(const CAABB& a, const CAABB& b) {
+        return a.max.x > b.min.x && a.min.x < b.max.x &&
+               a.max.y > b.min.y && a.min.y < b.max.y;
     }
     
-    void insert(EntityID entityId, const CAABB& bounds) override {
-        // TODO: Implement recursive insertion
+    CAABB looseBounds(const Node& node) const {
+        float loose = node.halfSize * m_looseness;
+        CAABB bounds;
+        bounds.min = glm::vec3(node.center.x - loose, node.center.y - loose, -std::numeric_limits<float>::max());
+        bounds.max = glm::vec3(node.center.x + loose, node.center.y + loose, std::numeric_limits<float>::max());
+        return bounds;
     }
     
-    void remove(EntityID entityId) override {
-        // TODO: Implement recursive removal with node merging
+    /**
+     * Check if node's loose bounds can hold the given AABB
+     * The root holds everything so out-of-world entities are never lost
+     */
+    bool fitsLoose(uint32_t nodeIndex, const CAABB& bounds) const {
+        if (nodeIndex == 0) {
+            return true;
+        }
+        const Node& node = m_nodes[nodeIndex];
+        float loose = node.halfSize * m_looseness;
+        return bounds.min.x >= node.center.x - loose && bounds.max.x <= node.center.x + loose &&
+               bounds.min.y >= node.center.y - loose && bounds.max.y <= node.center.y + loose;
     }
     
-    void update(EntityID entityId, const CAABB& newBounds) override {
-        // TODO: Implement efficient update (may need remove + insert)
+    /**
+     * Child of a non-leaf node that should hold bounds, or INVALID_NODE if it stays in node
+     */
+    uint32_t childFor(uint32_t nodeIndex, const CAABB& bounds) const {
+        const Node& node = m_nodes[nodeIndex];
+        float childHalf = node.halfSize * 0.5f;
+        glm::vec3 center = AABBUtils::getCenter(bounds);
+        glm::vec3 halfExtents = AABBUtils::getHalfExtents(bounds);
+        
+        // Center outside the tight square only happens at the root
+        if (std::abs(center.x - node.center.x) > node.halfSize ||
+            std::abs(center.y - node.center.y) > node.halfSize) {
+            return INVALID_NODE;
+        }
+        float maxExtent = childHalf * (m_looseness - 1.0f);
+        if (halfExtents.x > maxExtent || halfExtents.y > maxExtent) {
+            return INVALID_NODE;
+        }
+        
+        uint32_t quadrant = (center.x >= node.center.x ? 1u : 0u) | (center.y >= node.center.y ? 2u : 0u);
+        return node.firstChild + quadrant;
     }
     
-    void clear() override {
-        // TODO: Clear all nodes
+    /**
+     * Deepest existing node that should hold bounds
+     */
+    uint32_t findTargetNode(const CAABB& bounds) const {
+        uint32_t nodeIndex = 0;
+        while (!m_nodes[nodeIndex].isLeaf()) {
+            uint32_t child = childFor(nodeIndex, bounds);
+            if (child == INVALID_NODE) {
+                break;
+            }
+            nodeIndex = child;
+        }
+        return nodeIndex;
     }
     
-    std::vector<EntityID> query(const CAABB& region) const override {
-        // TODO: Implement recursive region query
-        return {};
+    bool canSplit(const Node& node) const {
+        return node.depth < m_maxDepth && node.halfSize >= m_minNodeSize;
     }
     
-    std::vector<CollisionPair> findCollisions() const override {
-        // TODO: Implement collision detection using tree traversal
-        return {};
+    uint32_t allocateChildren(uint32_t parentIndex) {
+        uint32_t first;
+        if (!m_freeBlocks.empty()) {
+            first = m_freeBlocks.back();
+            m_freeBlocks.pop_back();
+        } else {
+            first = static_cast<uint32_t>(m_nodes.size());
+            m_nodes.resize(m_nodes.size() + 4);
+        }
+        
+        const Node& parent = m_nodes[parentIndex];
+        float childHalf = parent.halfSize * 0.5f;
+        for (uint32_t q = 0; q < 4; ++q) {
+            Node& child = m_nodes[first + q];
+            child.center = glm::vec2(parent.center.x + ((q & 1u) ? childHalf : -childHalf),
+                                     parent.center.y + ((q & 2u) ? childHalf : -childHalf));
+            child.halfSize = childHalf;
+            child.parent = parentIndex;
+            child.firstChild = INVALID_NODE;
+            child.depth = parent.depth + 1;
+            child.subtreeCount = 0;
+            child.items.clear(); // Keeps capacity from previous use
+        }
+        return first;
     }
     
-    std::vector<EntityID> queryRadius(const glm::vec3& point, float radius) const override {
-        // TODO: Implement radius query
-        return {};
+    /**
+     * Subdivide a leaf and push down every item that fits a child
+     */
+    void split(uint32_t nodeIndex) {
+        uint32_t first = allocateChildren(nodeIndex);
+        m_nodes[nodeIndex].firstChild = first;
+        
+        std::vector<Item>& items = m_nodes[nodeIndex].items;
+        size_t kept = 0;
+        for (size_t i = 0; i < items.size(); ++i) {
+            uint32_t child = childFor(nodeIndex, items[i].bounds);
+            if (child == INVALID_NODE) {
+                items[kept++] = items[i];
+                continue;
+            }
+            m_nodes[child].items.push_back(items[i]);
+            m_nodes[child].subtreeCount++;
+            m_entityNode[items[i].id] = child;
+        }
+        items.resize(kept);
+        
+        for (uint32_t q = 0; q < 4; ++q) {
+            splitIfNeeded(first + q);
+        }
     }
     
-    void getStatistics(PartitionStats& stats) const override {
-        // TODO: Calculate tree statistics (depth, nodes, etc.)
-        stats.reset();
+    void splitIfNeeded(uint32_t nodeIndex) {
+        const Node& node = m_nodes[nodeIndex];
+        if (node.isLeaf() && node.items.size() > m_maxEntitiesPerNode && canSplit(node)) {
+            split(nodeIndex);
+        }
     }
     
-    const char* getStrategyName() const override {
-        return "Quadtree (TODO)";
+    /**
+     * Collapse children into their parent while the subtree is small enough
+     */
+    void mergeUpwards(uint32_t nodeIndex) {
+        while (nodeIndex != INVALID_NODE) {
+            Node& node = m_nodes[nodeIndex];
+            if (!node.isLeaf() && node.subtreeCount <= m_maxEntitiesPerNode) {
+                bool childrenAreLeaves = true;
+                for (uint32_t q = 0; q < 4; ++q) {
+                    childrenAreLeaves = childrenAreLeaves && m_nodes[node.firstChild + q].isLeaf();
+                }
+                if (!childrenAreLeaves) {
+                    return;
+                }
+                
+                for (uint32_t q = 0; q < 4; ++q) {
+                    for (const Item& item : m_nodes[node.firstChild + q].items) {
+                        node.items.push_back(item);
+                        m_entityNode[item.id] = nodeIndex;
+                    }
+                    m_nodes[node.firstChild + q].items.clear();
+                }
+                m_freeBlocks.push_back(node.firstChild);
+                node.firstChild = INVALID_NODE;
+            }
+            nodeIndex = node.parent;
+        }
     }
     
-    bool isValid() const override {
-        // TODO: Validate tree structure
-        return true;
+    void adjustSubtreeCounts(uint32_t nodeIndex, int delta) {
+        while (nodeIndex != INVALID_NODE) {
+            m_nodes[nodeIndex].subtreeCount += delta;
+            nodeIndex = m_nodes[nodeIndex].parent;
+        }
     }
-};
-
-/**
- * TODO: Spatial Hashing Implementation
- * 
- * Hash-based spatial partitioning for infinite or very large worlds.
- * Similar to uniform grid but uses hash table instead of array.
- * 
- * Implementation notes:
- * - Hash world coordinates to bucket indices
- * - Handle hash collisions gracefully
- * - No fixed world bounds - scales infinitely
- * - Great for streaming/procedural worlds
- */
-class SpatialHashStrategy : public SpatialPartitionStrategy {
+    
+    /**
+     * Test one item against every item in nodes whose loose bounds it overlaps
+     * Loose nodes overlap their siblings, so pairs can span any two nodes;
+     * each pair is reported once, from the item with the smaller ID.
+     */
+    void collideItem(const Item& item, std::vector<CollisionPair>& collisions, size_t& checks) const {
+        m_nodeStack.clear();
+        m_nodeStack.push_back(0);
+        while (!m_nodeStack.empty()) {
+            const Node& node = m_nodes[m_nodeStack.back()];
+            m_nodeStack.pop_back();
+            
+            for (const Item& other : node.items) {
+                if (other.id <= item.id) {
+                    continue;
+                }
+                checks++;
+                if (AABBUtils::intersects(item.bounds, other.bounds)) {
+                    collisions.emplace_back(item.id, other.id);
+                }
+            }
+            
+            if (node.isLeaf()) {
+                continue;
+            }
+            for (uint32_t q = 0; q < 4; ++q) {
+                const Node& child = m_nodes[node.firstChild + q];
+                if (child.subtreeCount > 0 && overlapsXY(looseBounds(child), item.bounds)) {
+                    m_nodeStack.push_back(node.firstChild + q);
+                }
+            }
+        }
+    }
+    
+    void queryNode(uint32_t nodeIndex, const CAABB& region, std::vector<EntityID>& result) const {
+        const Node& node = m_nodes[nodeIndex];
+        if (node.subtreeCount == 0 || (nodeIndex != 0 && !overlapsXY(looseBounds(node), region))) {
+            return;
+        }
+        for (const Item& item : node.items) {
+            if (AABBUtils::intersects(item.bounds, region)) {
+                result.push_back(item.id);
+            }
+        }
+        if (!node.isLeaf()) {
+            for (uint32_t q = 0; q < 4; ++q) {
+                queryNode(node.firstChild + q, region, result);
+            }
+        }
+    }
+    
+    Item* findItem(uint32_t nodeIndex, EntityID entityId) {
+        for (Item& item : m_nodes[nodeIndex].items) {
+            if (item.id == entityId) {
+                return &item;
+            }
+        }
+        return nullptr;
+    }
+    
 public:
-    SpatialHashStrategy(float cellSize = EngineConstants::SpatialPartition::SPATIAL_HASH_DEFAULT_CELL_SIZE) {
-        // TODO: Implement spatial hash construction
-        std::cout << "TODO: SpatialHashStrategy not yet implemented" << std::endl;
+    // Buffer variants use the base-class forwarding defaults
+    using SpatialPartitionStrategy::query;
+    using SpatialPartitionStrategy::findCollisions;
+    
+    QuadtreeStrategy(const glm::vec3& worldMin, const glm::vec3& worldMax,
+                     float minNodeSize = EngineConstants::SpatialPartition::DEFAULT_CELL_SIZE,
+                     size_t maxEntitiesPerNode = EngineConstants::SpatialPartition::QUADTREE_MAX_ENTITIES_PER_NODE)
+        : m_maxEntitiesPerNode(maxEntitiesPerNode),
+          m_maxDepth(EngineConstants::SpatialPartition::QUADTREE_MAX_DEPTH),
+          m_minNodeSize(minNodeSize),
+          m_looseness(EngineConstants::SpatialPartition::QUADTREE_LOOSENESS) {
+        
+        // Root is the square enclosing the XY extent of the world
+        Node root;
+        root.center = glm::vec2((worldMin.x + worldMax.x) * 0.5f, (worldMin.y + worldMax.y) * 0.5f);
+        root.halfSize = std::max(worldMax.x - worldMin.x, worldMax.y - worldMin.y) * 0.5f;
+        m_nodes.push_back(std::move(root));
     }
     
     void insert(EntityID entityId, const CAABB& bounds) override {
-        // TODO: Hash entity position and insert into buckets
+        if (m_entityNode.find(entityId) != m_entityNode.end()) {
+            update(entityId, bounds);
+            return;
+        }
+        
+        uint32_t nodeIndex = findTargetNode(bounds);
+        m_nodes[nodeIndex].items.push_back({entityId, bounds});
+        m_entityNode[entityId] = nodeIndex;
+        adjustSubtreeCounts(nodeIndex, 1);
+        splitIfNeeded(nodeIndex);
     }
     
     void remove(EntityID entityId) override {
-        // TODO: Remove from hash buckets
+        auto it = m_entityNode.find(entityId);
+        if (it == m_entityNode.end()) {
+            return; // Entity not found
+        }
+        
+        uint32_t nodeIndex = it->second;
+        std::vector<Item>& items = m_nodes[nodeIndex].items;
+        Item* item = findItem(nodeIndex, entityId);
+        *item = items.back();
+        items.pop_back();
+        m_entityNode.erase(it);
+        
+        adjustSubtreeCounts(nodeIndex, -1);
+        mergeUpwards(nodeIndex);
     }
     
     void update(EntityID entityId, const CAABB& newBounds) override {
-        // TODO: Rehash if entity moved to different buckets
+        auto it = m_entityNode.find(entityId);
+        if (it == m_entityNode.end()) {
+            // Entity not found, just insert
+            insert(entityId, newBounds);
+            return;
+        }
+        
+        // Still inside its node's loose bounds: refresh bounds in place
+        if (fitsLoose(it->second, newBounds)) {
+            findItem(it->second, entityId)->bounds = newBounds;
+            return;
+        }
+        
+        remove(entityId);
+        insert(entityId, newBounds);
     }
     
     void clear() override {
-        // TODO: Clear hash table
+        // Return every block to the pool, keeping item vector capacity
+        m_freeBlocks.clear();
+        for (uint32_t first = 1; first < m_nodes.size(); first += 4) {
+            m_freeBlocks.push_back(first);
+        }
+        for (auto& node : m_nodes) {
+            node.items.clear();
+            node.subtreeCount = 0;
+            node.firstChild = INVALID_NODE;
+        }
+        m_entityNode.clear();
     }
     
     std::vector<EntityID> query(const CAABB& region) const override {
-        // TODO: Hash region and check relevant buckets
-        return {};
+        std::vector<EntityID> result;
+        queryNode(0, region, result);
+        return result;
     }
     
     std::vector<CollisionPair> findCollisions() const override {
-        // TODO: Check all non-empty buckets for collisions
-        return {};
+        auto start = std::chrono::high_resolution_clock::now();
+        
+        std::vector<CollisionPair> collisions;
+        size_t totalChecks = 0;
+        
+        for (const auto& node : m_nodes) {
+            for (const Item& item : node.items) {
+                collideItem(item, collisions, totalChecks);
+            }
+        }
+        
+        auto end = std::chrono::high_resolution_clock::now();
+        m_stats.lastQueryTimeMs = std::chrono::duration<double, std::milli>(end - start).count();
+        m_stats.totalCollisionChecks = totalChecks;
+        
+        return collisions;
     }
     
     std::vector<EntityID> queryRadius(const glm::vec3& point, float radius) const override {
-        // TODO: Hash point with radius and check buckets
-        return {};
+        // Create AABB around the point with radius
+        glm::vec3 radiusVec(radius);
+        CAABB queryRegion;
+        queryRegion.min = point - radiusVec;
+        queryRegion.max = point + radiusVec;
+        
+        std::vector<EntityID> result;
+        float radiusSquared = radius * radius;
+        
+        // Filter candidates by actual distance to entity center
+        std::vector<uint32_t> nodes{0};
+        while (!nodes.empty()) {
+            uint32_t nodeIndex = nodes.back();
+            const Node& node = m_nodes[nodeIndex];
+            nodes.pop_back();
+            if (node.subtreeCount == 0 || (nodeIndex != 0 && !overlapsXY(looseBounds(node), queryRegion))) {
+                continue;
+            }
+            for (const Item& item : node.items) {
+                glm::vec3 diff = AABBUtils::getCenter(item.bounds) - point;
+                float distanceSquared = diff.x * diff.x + diff.y * diff.y + diff.z * diff.z;
+                if (distanceSquared <= radiusSquared) {
+                    result.push_back(item.id);
+                }
+            }
+            if (!node.isLeaf()) {
+                for (uint32_t q = 0; q < 4; ++q) {
+                    nodes.push_back(node.firstChild + q);
+                }
+            }
+        }
+        
+        return result;
     }
     
     void getStatistics(PartitionStats& stats) const override {
-        // TODO: Calculate hash table statistics
-        stats.reset();
+        stats = m_stats;
+        stats.totalNodes = 0;
+        stats.maxDepth = 0;
+        stats.totalEntities = m_entityNode.size();
+        stats.emptyNodes = 0;
+        stats.maxEntitiesInSingleNode = 0;
+        
+        size_t nonEmptyNodes = 0;
+        std::vector<uint32_t> nodes{0};
+        while (!nodes.empty()) {
+            const Node& node = m_nodes[nodes.back()];
+            nodes.pop_back();
+            
+            stats.totalNodes++;
+            stats.maxDepth = std::max(stats.maxDepth, node.depth);
+            if (node.items.empty()) {
+                stats.emptyNodes++;
+            } else {
+                nonEmptyNodes++;
+                stats.maxEntitiesInSingleNode = std::max(stats.maxEntitiesInSingleNode, node.items.size());
+            }
+            if (!node.isLeaf()) {
+                for (uint32_t q = 0; q < 4; ++q) {
+                    nodes.push_back(node.firstChild + q);
+                }
+            }
+        }
+        stats.averageEntitiesPerNode = nonEmptyNodes > 0 ? stats.totalEntities / nonEmptyNodes : 0;
     }
     
     const char* getStrategyName() const override {
-        return "SpatialHash (TODO)";
+        return "Quadtree";
+    }
+    
+    bool hasFixedBounds() const override {
+        return false;
     }
     
     bool isValid() const override {
-        // TODO: Validate hash table state
-        return true;
+        if (m_nodes.empty() || m_nodes[0].halfSize <= 0.0f) {
+            return false;
+        }
+        
+        // Every entity is held by its recorded node, within that node's loose bounds
+        for (const auto& pair : m_entityNode) {
+            const Node& node = m_nodes[pair.second];
+            auto it = std::find_if(node.items.begin(), node.items.end(),
+                                   [&](const Item& item) { return item.id == pair.first; });
+            if (it == node.items.end() || !fitsLoose(pair.second, it->bounds)) {
+                return false;
+            }
+        }
+        
+        // Subtree counts add up and no entity is stored twice
+        size_t reachable = 0;
+        std::vector<uint32_t> nodes{0};
+        while (!nodes.empty()) {
+            const Node& node = m_nodes[nodes.back()];
+            nodes.pop_back();
+            
+            size_t childCount = 0;
+            if (!node.isLeaf()) {
+                for (uint32_t q = 0; q < 4; ++q) {
+                    childCount += m_nodes[node.firstChild + q].subtreeCount;
+                    nodes.push_back(node.firstChild + q);
+                }
+            }
+            if (node.subtreeCount != node.items.size() + childCount) {
+                return false;
+            }
+            reachable += node.items.size();
+        }
+        
+        return reachable == m_entityNode.size();
     }
 };
 
 // ============================================================================
-// Factory Implementation
+// Spatial Hash Implementation
 // ============================================================================
 
-std::unique_ptr<SpatialPartitionStrategy> createSpatialPartition(
-    PartitionType type,
-    const glm::vec3& worldMin,
+/**
+ * Spatial Hashing Strategy
+ * 
+ * Hashed uniform grid with no world bounds: only occupied cells exist,
+ * so memory scales with the populated area rather than the world size.
+ * Suited to streaming/procedurally extended maps.
+ * 
+ * Implementation notes:
+ * - Cell coordinates (floor(pos / cellSize)) are packed into a 64-bit key,
+ *   21 bits per axis (about +/-1M cells per axis; beyond that coordinates clamp)
+ * - Keys live in an open-addressing table (linear probing, power-of-two
+ *   capacity, backward-shift deletion so no tombstones accumulate)
+ * - The table maps keys to a dense array of occupied cells; a cell is
+ *   dropped as soon as its last entity leaves
+ * - Entities live in a dense array; cells store dense entity indices
+ * - A pair is only reported from the cell holding the min corner of the
+ *   two boxes' overlap, so pairs spanning several cells need no dedup set
+ */
+class SpatialHashStrategy : public SpatialPartitionStrategy {
+private:
+    static constexpr uint64_t EMPTY_KEY = UINT64_MAX;
+    static constexpr int KEY_BITS = 21;
+    static constexpr int64_t KEY_BIAS = int64_t(1) << (KEY_BITS - 1);
+    static constexpr uint64_t KEY_MASK = (uint64_t(1) << KEY_BITS) - 1;
+    static constexpr uint32_t INVALID_INDEX = UINT32_MAX;
+    
+    struct Slot {
+        uint64_t key = EMPTY_KEY;
+        uint32_t cell = INVALID_INDEX;
+    };
+    
+    struct HashCell {
+        uint64_t key;
+        std::vector<uint32_t> entities; // Dense entity indices
+    };
+    
+    struct EntityRecord {
+        EntityID id;
+        CAABB bounds;
+        glm::ivec3 minCell;
+        glm::ivec3 maxCell;
+    };
+    
+    float m_cellSize;
+    float m_inverseCellSize;
+    
+    std::vector<Slot> m_table;        // Open-addressing key table
+    std::vector<HashCell> m_cells;    // Occupied cells only
+    std::vector<EntityRecord> m_entities;
+    std::unordered_map<EntityID, uint32_t> m_entityIndex;
+    
+    // Per-entity stamp for duplicate-free queries without a hash set
+    mutable std::vector<uint32_t> m_queryStamp;
+    mutable uint32_t m_currentStamp = 0;
+    
+    // Performance tracking
+    mutable PartitionStats m_stats;
+    mutable size_t m_maxProbeLength = 0;
+    
+    glm::ivec3 cellOf(const glm::vec3& position) const {
+        auto axis = [this](float value) {
+            float cell = std::floor(value * m_inverseCellSize);
+            return static_cast<int>(std::clamp(cell, static_cast<float>(-KEY_BIAS), static_cast<float>(KEY_BIAS - 1)));
+        };
+        return glm::ivec3(axis(position.x), axis(position.y), axis(position.z));
+    }
+    
+    static uint64_t packKey(const glm::ivec3& cell) {
+        return (static_cast<uint64_t>(cell.x + KEY_BIAS) & KEY_MASK) |
+               ((static_cast<uint64_t>(cell.y + KEY_BIAS) & KEY_MASK) << KEY_BITS) |
+               ((static_cast<uint64_t>(cell.z + KEY_BIAS) & KEY_MASK) << (2 * KEY_BITS));
+    }
+    
+    static size_t hashKey(uint64_t key) {
+        // 64-bit finalizer (splitmix64) spreads neighbouring cells across the table
+        key ^= key >> 30;
+        key *= 0xbf58476d1ce4e5b9ULL;
+        key ^= key >> 27;
+        key *= 0x94d049bb133111ebULL;
+        key ^= key >> 31;
+        return static_cast<size_t>(key);
+    }
+    
+    size_t tableMask() const { return m_table.size() - 1; }
+    
+    /**
+     * Find table slot holding key, or the empty slot where it would go
+     */
+    size_t findSlot(uint64_t key) const {
+        size_t slot = hashKey(key) & tableMask();
+        size_t probes = 0;
+        while (m_table[slot].key != EMPTY_KEY && m_table[slot].key != key) {
+            slot = (slot + 1) & tableMask();
+            probes++;
+        }
+        m_maxProbeLength = std::max(m_maxProbeLength, probes);
+        return slot;
+    }
+    
+    uint32_t findCell(uint64_t key) const {
+        return m_table[findSlot(key)].cell;
+    }
+    
+    void rehash(size_t capacity) {
+        m_table.assign(capacity, Slot{});
+        m_maxProbeLength = 0;
+        for (uint32_t i = 0; i < m_cells.size(); ++i) {
+            m_table[findSlot(m_cells[i].key)] = Slot{m_cells[i].key, i};
+        }
+    }
+    
+    uint32_t findOrCreateCell(uint64_t key) {
+        size_t slot = findSlot(key);
+        if (m_table[slot].key == key) {
+            return m_table[slot].cell;
+        }
+        
+        // Keep load factor at or below 1/2 so probe sequences stay short
+        if ((m_cells.size() + 1) * 2 > m_table.size()) {
+            rehash(m_table.size() * 2);
+            slot = findSlot(key);
+        }
+        
+        uint32_t cellIndex = static_cast<uint32_t>(m_cells.size());
+        m_cells.push_back(HashCell{key, {}});
+        m_table[slot] = Slot{key, cellIndex};
+        return cellIndex;
+    }
+    
+    /**
+     * Remove an empty cell from the table (backward-shift) and the dense array (swap-remove)
+     */
+    void eraseCell(uint32_t cellIndex) {
+        size_t hole = findSlot(m_cells[cellIndex].key);
+        size_t next = (hole + 1) & tableMask();
+        while (m_table[next].key != EMPTY_KEY) {
+            size_t home = hashKey(m_table[next].key) & tableMask();
+            // Move entry back if the hole lies on its probe path (cyclic range [home, next))
+            bool holeOnPath = (next > hole) ? (home <= hole || home > next)
+                                            : (home <= hole && home > next);
+            if (holeOnPath) {
+                m_table[hole] = m_table[next];
+                hole = next;
+            }
+            next = (next + 1) & tableMask();
+        }
+        m_table[hole] = Slot{};
+        
+        uint32_t last = static_cast<uint32_t>(m_cells.size() - 1);
+        if (cellIndex != last) {
+            m_cells[cellIndex] = std::move(m_cells[last]);
+            m_table[findSlot(m_cells[cellIndex].key)].cell = cellIndex;
+        }
+        m_cells.pop_back();
+    }
+    
+    template<typename Fn>
+    static void forEachCell(const glm::ivec3& minCell, const glm::ivec3& maxCell, Fn&& fn) {
+        for (int z = minCell.z; z <= maxCell.z; ++z) {
+            for (int y = minCell.y; y <= maxCell.y; ++y) {
+                for (int x = minCell.x; x <= maxCell.x; ++x) {
+                    fn(glm::ivec3(x, y, z));
+                }
+            }
+        }
+    }
+    
+    void addToCells(uint32_t entityIndex, const glm::ivec3& minCell, const glm::ivec3& maxCell) {
+        forEachCell(minCell, maxCell, [&](const glm::ivec3& cell) {
+            m_cells[findOrCreateCell(packKey(cell))].entities.push_back(entityIndex);
+        });
+    }
+    
+    void removeFromCells(uint32_t entityIndex, const glm::ivec3& minCell, const glm::ivec3& maxCell) {
+        forEachCell(minCell, maxCell, [&](const glm::ivec3& cell) {
+            uint32_t cellIndex = findCell(packKey(cell));
+            if (cellIndex == INVALID_INDEX) {
+                return;
+            }
+            auto& entities = m_cells[cellIndex].entities;
+            auto it = std::find(entities.begin(), entities.end(), entityIndex);
+            if (it != entities.end()) {
+                *it = entities.back();
+                entities.pop_back();
+            }
+            if (entities.empty()) {
+                eraseCell(cellIndex);
+            }
+        });
+    }
+    
+    void replaceInCells(uint32_t from, uint32_t to, const glm::ivec3& minCell, const glm::ivec3& maxCell) {
+        forEachCell(minCell, maxCell, [&](const glm::ivec3& cell) {
+            auto& entities = m_cells[findCell(packKey(cell))].entities;
+            std::replace(entities.begin(), entities.end(), from, to);
+        });
+    }
+    
+    static size_t cellCount(const glm::ivec3& minCell, const glm::ivec3& maxCell) {
+        return static_cast<size_t>(maxCell.x - minCell.x + 1) *
+               static_cast<size_t>(maxCell.y - minCell.y + 1) *
+               static_cast<size_t>(maxCell.z - minCell.z + 1);
+    }
+    
+    uint32_t nextQueryStamp() const {
+        m_queryStamp.resize(m_entities.size(), 0);
+        if (++m_currentStamp == 0) {
+            std::fill(m_queryStamp.begin(), m_queryStamp.end(), 0);
+            m_currentStamp = 1;
+        }
+        return m_currentStamp;
+    }
+    
+public:
+    // Buffer variants use the base-class forwarding defaults
+    using SpatialPartitionStrategy::query;
+    using SpatialPartitionStrategy::findCollisions;
+    
+    SpatialHashStrategy(float cellSize = EngineConstants::SpatialPartition::SPATIAL_HASH_DEFAULT_CELL_SIZE)
+        : m_cellSize(cellSize), m_inverseCellSize(1.0f / cellSize) {
+        m_table.resize(static_cast<size_t>(EngineConstants::SpatialPartition::SPATIAL_HASH_INITIAL_CAPACITY));
+    }
+    
+    void insert(EntityID entityId, const CAABB& bounds) override {
+        if (m_entityIndex.find(entityId) != m_entityIndex.end()) {
+            update(entityId, bounds);
+            return;
+        }
+        
+        uint32_t entityIndex = static_cast<uint32_t>(m_entities.size());
+        EntityRecord record{entityId, bounds, cellOf(bounds.min), cellOf(bounds.max)};
+        m_entities.push_back(record);
+        m_entityIndex[entityId] = entityIndex;
+        addToCells(entityIndex, record.minCell, record.maxCell);
+    }
+    
+    void remove(EntityID entityId) override {
+        auto it = m_entityIndex.find(entityId);
+        if (it == m_entityIndex.end()) {
+            return; // Entity not found
+        }
+        
+        uint32_t entityIndex = it->second;
+        removeFromCells(entityIndex, m_entities[entityIndex].minCell, m_entities[entityIndex].maxCell);
+        m_entityIndex.erase(it);
+        
+        // Swap-remove from dense entity array, renumbering the moved entity in its cells
+        uint32_t last = static_cast<uint32_t>(m_entities.size() - 1);
+        if (entityIndex != last) {
+            const EntityRecord& moved = m_entities[last];
+            replaceInCells(last, entityIndex, moved.minCell, moved.maxCell);
+            m_entityIndex[moved.id] = entityIndex;
+            m_entities[entityIndex] = moved;
+        }
+        m_entities.pop_back();
+    }
+    
+    void update(EntityID entityId, const CAABB& newBounds) override {
+        auto it = m_entityIndex.find(entityId);
+        if (it == m_entityIndex.end()) {
+            // Entity not found, just insert
+            insert(entityId, newBounds);
+            return;
+        }
+        
+        EntityRecord& record = m_entities[it->second];
+        glm::ivec3 newMin = cellOf(newBounds.min);
+        glm::ivec3 newMax = cellOf(newBounds.max);
+        record.bounds = newBounds;
+        
+        // Same cell coverage: nothing to rehash
+        if (newMin == record.minCell && newMax == record.maxCell) {
+            return;
+        }
+        
+        uint32_t entityIndex = it->second;
+        glm::ivec3 oldMin = record.minCell;
+        glm::ivec3 oldMax = record.maxCell;
+        record.minCell = newMin;
+        record.maxCell = newMax;
+        
+        // Leave cells no longer covered, join newly covered ones
+        auto covers = [](const glm::ivec3& cell, const glm::ivec3& lo, const glm::ivec3& hi) {
+            return cell.x >= lo.x && cell.x <= hi.x && cell.y >= lo.y && cell.y <= hi.y &&
+                   cell.z >= lo.z && cell.z <= hi.z;
+        };
+        forEachCell(oldMin, oldMax, [&](const glm::ivec3& cell) {
+            if (!covers(cell, newMin, newMax)) {
+                removeFromCells(entityIndex, cell, cell);
+            }
+        });
+        forEachCell(newMin, newMax, [&](const glm::ivec3& cell) {
+            if (!covers(cell, oldMin, oldMax)) {
+                addToCells(entityIndex, cell, cell);
+            }
+        });
+    }
+    
+    void clear() override {
+        std::fill(m_table.begin(), m_table.end(), Slot{});
+        m_cells.clear();
+        m_entities.clear();
+        m_entityIndex.clear();
+        m_maxProbeLength = 0;
+    }
+    
+    std::vector<EntityID> query(const CAABB& region) const override {
+        std::vector<EntityID> result;
+        if (m_entities.empty()) {
+            return result;
+        }
+        
+        uint32_t stamp = nextQueryStamp();
+        auto visitCell = [&](const HashCell& cell) {
+            for (uint32_t entityIndex : cell.entities) {
+                if (m_queryStamp[entityIndex] == stamp) {
+                    continue;
+                }
+                m_queryStamp[entityIndex] = stamp;
+                if (AABBUtils::intersects(m_entities[entityIndex].bounds, region)) {
+                    result.push_back(m_entities[entityIndex].id);
+                }
+            }
+        };
+        
+        glm::ivec3 minCell = cellOf(region.min);
+        glm::ivec3 maxCell = cellOf(region.max);
+        if (cellCount(minCell, maxCell) > m_cells.size()) {
+            // Huge region: scanning occupied cells is cheaper than probing every key
+            for (const HashCell& cell : m_cells) {
+                visitCell(cell);
+            }
+        } else {
+            forEachCell(minCell, maxCell, [&](const glm::ivec3& cellCoords) {
+                uint32_t cellIndex = findCell(packKey(cellCoords));
+                if (cellIndex != INVALID_INDEX) {
+                    visitCell(m_cells[cellIndex]);
+                }
+            });
+        }
+        
+        return result;
+    }
+    
+    std::vector<CollisionPair> findCollisions() const override {
+        auto start = std::chrono::high_resolution_clock::now();
+        
+        std::vector<CollisionPair> collisions;
+        size_t totalChecks = 0;
+        
+        for (const HashCell& cell : m_cells) {
+            if (cell.entities.size() < EngineConstants::SpatialPartition::MIN_ENTITIES_FOR_COLLISION) continue;
+            
+            for (size_t i = 0; i < cell.entities.size(); ++i) {
+                const EntityRecord& a = m_entities[cell.entities[i]];
+                for (size_t j = i + 1; j < cell.entities.size(); ++j) {
+                    const EntityRecord& b = m_entities[cell.entities[j]];
+                    totalChecks++;
+                    if (!AABBUtils::intersects(a.bounds, b.bounds)) {
+                        continue;
+                    }
+                    // Report only from the cell containing the overlap's min corner
+                    if (packKey(cellOf(glm::max(a.bounds.min, b.bounds.min))) == cell.key) {
+                        collisions.emplace_back(a.id, b.id);
+                    }
+                }
+            }
+        }
+        
+        auto end = std::chrono::high_resolution_clock::now();
+        m_stats.lastQueryTimeMs = std::chrono::duration<double, std::milli>(end - start).count();
+        m_stats.totalCollisionChecks = totalChecks;
+        
+        return collisions;
+    }
+    
+    std::vector<EntityID> queryRadius(const glm::vec3& point, float radius) const override {
+        // Create AABB around the point with radius
+        glm::vec3 radiusVec(radius);
+        CAABB queryRegion;
+        queryRegion.min = point - radiusVec;
+        queryRegion.max = point + radiusVec;
+        
+        // Filter candidates by actual distance
+        std::vector<EntityID> result;
+        float radiusSquared = radius * radius;
+        
+        for (EntityID entityId : query(queryRegion)) {
+            glm::vec3 entityCenter = AABBUtils::getCenter(m_entities[m_entityIndex.at(entityId)].bounds);
+            glm::vec3 diff = entityCenter - point;
+            float distanceSquared = diff.x * diff.x + diff.y * diff.y + diff.z * diff.z;
+            if (distanceSquared <= radiusSquared) {
+                result.push_back(entityId);
+            }
+        }
+        
+        return result;
+    }
+    
+    void getStatistics(PartitionStats& stats) const override {
+        stats = m_stats;
+        stats.totalNodes = m_cells.size();  // Occupied cells only
+        stats.maxDepth = m_maxProbeLength;  // Longest probe sequence seen (hash table "depth")
+        stats.totalEntities = m_entities.size();
+        stats.emptyNodes = 0;
+        
+        size_t totalEntitiesInCells = 0;
+        size_t maxEntitiesInCell = 0;
+        for (const HashCell& cell : m_cells) {
+            totalEntitiesInCells += cell.entities.size();
+            maxEntitiesInCell = std::max(maxEntitiesInCell, cell.entities.size());
+        }
+        stats.maxEntitiesInSingleNode = maxEntitiesInCell;
+        stats.averageEntitiesPerNode = m_cells.empty() ? 0 : totalEntitiesInCells / m_cells.size();
+    }
+    
+    const char* getStrategyName() const override {
+        return "SpatialHash";
+    }
+    
+    bool hasFixedBounds() const override {
+        return false;
+    }
+    
+    bool isValid() const override {
+        if (m_cellSize <= 0.0f || m_cells.size() * 2 > m_table.size()) {
+            return false;
+        }
+        
+        // Table and dense cell array agree, and no cell is empty
+        size_t usedSlots = 0;
+        for (const Slot& slot : m_table) {
+            if (slot.key == EMPTY_KEY) continue;
+            usedSlots++;
+            if (slot.cell >= m_cells.size() || m_cells[slot.cell].key != slot.key ||
+                findCell(slot.key) != slot.cell || m_cells[slot.cell].entities.empty()) {
+                return false;
+            }
+        }
+        if (usedSlots != m_cells.size()) {
+            return false;
+        }
+        
+        // Every entity is listed in every cell it covers
+        for (uint32_t i = 0; i < m_entities.size(); ++i) {
+            const EntityRecord& record = m_entities[i];
+            auto indexIt = m_entityIndex.find(record.id);
+            if (indexIt == m_entityIndex.end() || indexIt->second != i) {
+                return false;
+            }
+            bool listed = true;
+            forEachCell(record.minCell, record.maxCell, [&](const glm::ivec3& cell) {
+                uint32_t cellIndex = findCell(packKey(cell));
+                listed = listed && cellIndex != INVALID_INDEX &&
+                         std::find(m_cells[cellIndex].entities.begin(), m_cells[cellIndex].entities.end(), i) !=
+                             m_cells[cellIndex].entities.end();
+            });
+            if (!listed) {
+                return false;
+            }
+        }
+        
+        return true;
+    }
+};
+
+// ============================================================================
+// Sweep and Prune Implementation
+// ============================================================================
+
+/**
+ * Sweep-and-Prune Strategy
+ * 
+ * Keeps the min and max endpoints of every entity's AABB sorted along one
+ * axis (the world's longest). Pairs whose intervals overlap on that axis
+ * are candidates; the full AABB test rejects the rest.
+ * 
+ * Implementation notes:
+ * - Endpoints live in one persistent array that is never rebuilt;
+ *   update() only rewrites an entity's two endpoint values, and the next
+ *   query restores order with one insertion sort pass over the array.
+ *   With frame-to-frame coherence the array is nearly sorted, so this is
+ *   O(N + swaps) where swaps counts endpoints that actually changed order
+ *   (sorting per update() instead would pay for neighbours not yet moved)
+ * - insert() appends and remove() leaves dead endpoints behind; the next
+ *   query compacts, and uses std::sort when new endpoints were appended,
+ *   so a rebuild is O(N log N) rather than N insertion passes
+ * - Equal values order max endpoints before min endpoints, so touching
+ *   boxes (not intersecting under AABBUtils::intersects) never overlap
+ * - findCollisions() is one sweep over the endpoints with an active list;
+ *   each pair is met exactly once, so no dedup is needed
+ * - No world bounds: entities anywhere are kept
+ * - Statistics: nodes are endpoints, depth is the largest active list seen
+ *   in the last sweep (entities overlapping on the sort axis at once)
+ */
+class SweepAndPruneStrategy : public SpatialPartitionStrategy {
+private:
+    static constexpr uint32_t INVALID_INDEX = UINT32_MAX;
+    
+    struct Endpoint {
+        float value;
+        uint32_t entity;  // Dense entity index, INVALID_INDEX once removed
+        bool isMax;
+        
+        bool operator<(const Endpoint& other) const {
+            // Max before min on ties: touching intervals do not overlap
+            return value < other.value || (value == other.value && isMax && !other.isMax);
+        }
+    };
+    
+    struct EntityRecord {
+        EntityID id;
+        CAABB bounds;
+        uint32_t minEndpoint;  // Positions in m_endpoints
+        uint32_t maxEndpoint;
+    };
+    
+    static constexpr uint32_t CLOSED_SLOT = UINT32_MAX - 1;
+    
+    struct ActiveEntry {
+        CAABB bounds;  // Copied so the sweep's inner loop reads contiguous memory
+        EntityID id;
+        uint32_t entity;
+    };
+    
+    int m_axis;
+    
+    // Sorted along m_axis once deferred work is applied; that happens
+    // inside const queries, hence mutable
+    mutable std::vector<Endpoint> m_endpoints;
+    mutable std::vector<EntityRecord> m_entities;
+    mutable bool m_needsFullSort = false;  // Endpoints appended by insert()
+    mutable bool m_needsResort = false;    // Endpoint values changed by update()
+    mutable size_t m_deadEndpoints = 0;
+    std::unordered_map<EntityID, uint32_t> m_entityIndex;
+    
+    // Sweep scratch, reused across calls
+    mutable std::vector<ActiveEntry> m_active;   // Entities whose interval is open
+    mutable std::vector<uint32_t> m_activeSlot;  // Position of each entity in m_active
+    
+    // Performance tracking
+    mutable PartitionStats m_stats;
+    mutable size_t m_maxActive = 0;
+    
+    void setEndpointPosition(uint32_t position) const {
+        const Endpoint& endpoint = m_endpoints[position];
+        if (endpoint.entity == INVALID_INDEX) {
+            return;
+        }
+        EntityRecord& record = m_entities[endpoint.entity];
+        (endpoint.isMax ? record.maxEndpoint : record.minEndpoint) = position;
+    }
+    
+    /**
+     * Apply deferred removals and insertions before reading the endpoint order
+     */
+    void ensureSorted() const {
+        if (m_deadEndpoints == 0 && !m_needsFullSort && !m_needsResort) {
+            return;
+        }
+        if (m_deadEndpoints > 0) {
+            m_endpoints.erase(std::remove_if(m_endpoints.begin(), m_endpoints.end(),
+                                             [](const Endpoint& e) { return e.entity == INVALID_INDEX; }),
+                              m_endpoints.end());
+            m_deadEndpoints = 0;
+        }
+        if (m_needsFullSort) {
+            std::sort(m_endpoints.begin(), m_endpoints.end());
+        } else if (m_needsResort) {
+            // Nearly sorted after coherent motion: insertion sort is linear plus swaps
+            for (size_t i = 1; i < m_endpoints.size(); ++i) {
+                if (!(m_endpoints[i] < m_endpoints[i - 1])) {
+                    continue;
+                }
+                Endpoint moving = m_endpoints[i];
+                size_t j = i;
+                do {
+                    m_endpoints[j] = m_endpoints[j - 1];
+                    --j;
+                } while (j > 0 && moving < m_endpoints[j - 1]);
+                m_endpoints[j] = moving;
+            }
+        }
+        m_needsFullSort = false;
+        m_needsResort = false;
+        for (uint32_t i = 0; i < m_endpoints.size(); ++i) {
+            setEndpointPosition(i);
+        }
+    }
+    
+public:
+    // Buffer variants: findCollisions is native, query uses the base-class default
+    using SpatialPartitionStrategy::query;
+    
+    SweepAndPruneStrategy(const glm::vec3& worldMin, const glm::vec3& worldMax) {
+        // Sort along the longest world axis, where intervals overlap least
+        glm::vec3 size = worldMax - worldMin;
+        m_axis = (size.x >= size.y && size.x >= size.z) ? 0 : (size.y >= size.z ? 1 : 2);
+    }
+    
+    void insert(EntityID entityId, const CAABB& bounds) override {
+        if (m_entityIndex.find(entityId) != m_entityIndex.end()) {
+            update(entityId, bounds);
+            return;
+        }
+        
+        uint32_t entityIndex = static_cast<uint32_t>(m_entities.size());
+        uint32_t last = static_cast<uint32_t>(m_endpoints.size());
+        m_entities.push_back(EntityRecord{entityId, bounds, last, last + 1});
+        m_entityIndex[entityId] = entityIndex;
+        
+        // Sorted in bulk by the next query
+        m_endpoints.push_back(Endpoint{bounds.min[m_axis], entityIndex, false});
+        m_endpoints.push_back(Endpoint{bounds.max[m_axis], entityIndex, true});
+        m_needsFullSort = true;
+    }
+    
+    void remove(EntityID entityId) override {
+        auto it = m_entityIndex.find(entityId);
+        if (it == m_entityIndex.end()) {
+            return; // Entity not found
+        }
+        
+        uint32_t entityIndex = it->second;
+        m_entityIndex.erase(it);
+        
+        // Leave dead endpoints in place; the next query compacts them
+        m_endpoints[m_entities[entityIndex].minEndpoint].entity = INVALID_INDEX;
+        m_endpoints[m_entities[entityIndex].maxEndpoint].entity = INVALID_INDEX;
+        m_deadEndpoints += 2;
+        
+        // Swap-remove from dense entity array, renumbering the moved entity's endpoints
+        uint32_t last = static_cast<uint32_t>(m_entities.size() - 1);
+        if (entityIndex != last) {
+            m_entities[entityIndex] = m_entities[last];
+            const EntityRecord& moved = m_entities[entityIndex];
+            m_endpoints[moved.minEndpoint].entity = entityIndex;
+            m_endpoints[moved.maxEndpoint].entity = entityIndex;
+            m_entityIndex[moved.id] = entityIndex;
+        }
+        m_entities.pop_back();
+    }
+    
+    void update(EntityID entityId, const CAABB& newBounds) override {
+        auto it = m_entityIndex.find(entityId);
+        if (it == m_entityIndex.end()) {
+            // Entity not found, just insert
+            insert(entityId, newBounds);
+            return;
+        }
+        
+        // Order is restored by the next query's insertion sort pass
+        EntityRecord& record = m_entities[it->second];
+        record.bounds = newBounds;
+        m_endpoints[record.minEndpoint].value = newBounds.min[m_axis];
+        m_endpoints[record.maxEndpoint].value = newBounds.max[m_axis];
+        m_needsResort = true;
+    }
+    
+    void clear() override {
+        m_endpoints.clear();
+        m_entities.clear();
+        m_entityIndex.clear();
+        m_needsFullSort = false;
+        m_needsResort = false;
+        m_deadEndpoints = 0;
+    }
+    
+    std::vector<EntityID> query(const CAABB& region) const override {
+        std::vector<EntityID> result;
+        ensureSorted();
+        
+        // Every entity starting at or before region's far edge is a candidate
+        for (const Endpoint& endpoint : m_endpoints) {
+            if (endpoint.value > region.max[m_axis]) {
+                break;
+            }
+            if (!endpoint.isMax && AABBUtils::intersects(m_entities[endpoint.entity].bounds, region)) {
+                result.push_back(m_entities[endpoint.entity].id);
+            }
+        }
+        
+        return result;
+    }
+    
+    void findCollisions(std::vector<CollisionPair>& out) const override {
+        auto start = std::chrono::high_resolution_clock::now();
+        
+        ensureSorted();
+        out.clear();
+        m_active.clear();
+        m_activeSlot.assign(m_entities.size(), INVALID_INDEX);
+        m_maxActive = 0;
+        size_t totalChecks = 0;
+        
+        for (const Endpoint& endpoint : m_endpoints) {
+            if (endpoint.isMax) {
+                // Interval closed: swap-remove from the active list
+                uint32_t slot = m_activeSlot[endpoint.entity];
+                m_activeSlot[endpoint.entity] = CLOSED_SLOT;
+                if (slot == INVALID_INDEX) {
+                    // Zero-width interval: its max sorts before its min, so it
+                    // never opens. It still overlaps every interval open here.
+                    const EntityRecord& a = m_entities[endpoint.entity];
+                    for (const ActiveEntry& b : m_active) {
+                        totalChecks++;
+                        if (AABBUtils::intersects(a.bounds, b.bounds)) {
+                            out.emplace_back(b.id, a.id);
+                        }
+                    }
+                    continue;
+                }
+                m_active[slot] = m_active.back();
+                m_activeSlot[m_active[slot].entity] = slot;
+                m_active.pop_back();
+                continue;
+            }
+            if (m_activeSlot[endpoint.entity] == CLOSED_SLOT) {
+                continue;
+            }
+            
+            // Interval opens: it overlaps every open interval on the sort axis
+            const EntityRecord& a = m_entities[endpoint.entity];
+            for (const ActiveEntry& b : m_active) {
+                totalChecks++;
+                if (AABBUtils::intersects(a.bounds, b.bounds)) {
+                    out.emplace_back(b.id, a.id);
+                }
+            }
+            m_activeSlot[endpoint.entity] = static_cast<uint32_t>(m_active.size());
+            m_active.push_back(ActiveEntry{a.bounds, a.id, endpoint.entity});
+            m_maxActive = std::max(m_maxActive, m_active.size());
+        }
+        
+        auto end = std::chrono::high_resolution_clock::now();
+        m_stats.lastQueryTimeMs = std::chrono::duration<double, std::milli>(end - start).count();
+        m_stats.totalCollisionChecks = totalChecks;
+    }
+    
+    std::vector<CollisionPair> findCollisions() const override {
+        std::vector<CollisionPair> collisions;
+        findCollisions(collisions);
+        return collisions;
+    }
+    
+    std::vector<EntityID> queryRadius(const glm::vec3& point, float radius) const override {
+        // Create AABB around the point with radius
+        glm::vec3 radiusVec(radius);
+        CAABB queryRegion;
+        queryRegion.min = point - radiusVec;
+        queryRegion.max = point + radiusVec;
+        
+        // Filter candidates by actual distance
+        std::vector<EntityID> result;
+        float radiusSquared = radius * radius;
+        
+        for (EntityID entityId : query(queryRegion)) {
+            glm::vec3 entityCenter = AABBUtils::getCenter(m_entities[m_entityIndex.at(entityId)].bounds);
+            glm::vec3 diff = entityCenter - point;
+            float distanceSquared = diff.x * diff.x + diff.y * diff.y + diff.z * diff.z;
+            if (distanceSquared <= radiusSquared) {
+                result.push_back(entityId);
+            }
+        }
+        
+        return result;
+    }
+    
+    void getStatistics(PartitionStats& stats) const override {
+        ensureSorted();
+        stats = m_stats;
+        stats.totalNodes = m_endpoints.size();  // Endpoints on the sort axis
+        stats.maxDepth = m_maxActive;           // Largest active list in the last sweep
+        stats.totalEntities = m_entities.size();
+        stats.emptyNodes = 0;
+        stats.maxEntitiesInSingleNode = m_maxActive;
+        stats.averageEntitiesPerNode = m_endpoints.empty() ? 0 : 1;
+    }
+    
+    const char* getStrategyName() const override {
+        return "SweepAndPrune";
+    }
+    
+    bool hasFixedBounds() const override {
+        return false;
+    }
+    
+    bool isValid() const override {
+        ensureSorted();
+        if (m_endpoints.size() != m_entities.size() * 2) {
+            return false;
+        }
+        
+        // Sorted, and every endpoint points back at its entity's record
+        for (uint32_t i = 0; i < m_endpoints.size(); ++i) {
+            const Endpoint& endpoint = m_endpoints[i];
+            if (i > 0 && endpoint < m_endpoints[i - 1]) {
+                return false;
+            }
+            if (endpoint.entity >= m_entities.size()) {
+                return false;
+            }
+            const EntityRecord& record = m_entities[endpoint.entity];
+            uint32_t expected = endpoint.isMax ? record.maxEndpoint : record.minEndpoint;
+            float value = endpoint.isMax ? record.bounds.max[m_axis] : record.bounds.min[m_axis];
+            if (expected != i || value != endpoint.value) {
+                return false;
+            }
+        }
+        
+        for (uint32_t i = 0; i < m_entities.size(); ++i) {
+            auto indexIt = m_entityIndex.find(m_entities[i].id);
+            if (indexIt == m_entityIndex.end() || indexIt->second != i) {
+                return false;
+            }
+        }
+        
+        return true;
+    }
+};
+
+// ============================================================================
+// Dynamic AABB Tree Implementation
+// ============================================================================
+
+/**
+ * Dynamic AABB Tree (BVH) Strategy
+ * 
+ * Binary bounding volume hierarchy over entity AABBs. Cost does not depend
+ * on a cell size, so very large and very small objects mix without the
+ * grid's cell blow-up.
+ * 
+ * Implementation notes:
+ * - Leaves store the entity's tight AABB and a fattened copy (margin plus
+ *   the last displacement, predicted ahead); internal nodes bound their
+ *   children's fat AABBs
+ * - update() is a bounds refresh while the tight AABB stays inside the fat
+ *   one; only entities leaving their fat bounds are reinserted
+ * - Insertion picks a sibling by surface area heuristic (cost of the new
+ *   parent plus the growth inherited by every ancestor)
+ * - After every structural change, ancestors are rebalanced by rotations
+ *   on subtree height (AVL-style, not strict: SAH may pair a leaf with a
+ *   tall subtree), so sorted insertion stays O(log N) deep
+ * - findCollisions() is a tree-vs-tree traversal of the tree against
+ *   itself: fat bounds prune subtrees, tight bounds decide leaf pairs, and
+ *   every pair is visited once
+ * - Nodes are pooled in a vector with a free list
+ * - No world bounds: entities anywhere are kept
+ */
+class DynamicAABBTreeStrategy : public SpatialPartitionStrategy {
+private:
+    static constexpr uint32_t INVALID_NODE = UINT32_MAX;
+    
+    struct Node {
+        CAABB fat;           // Fattened bounds (leaf) or union of children (internal)
+        CAABB tight;         // Entity bounds, leaves only
+        EntityID id = 0;     // Leaves only
+        uint32_t parent = INVALID_NODE; // Next free node while on the free list
+        uint32_t child1 = INVALID_NODE;
+        uint32_t child2 = INVALID_NODE;
+        int height = 0;      // Leaf = 0, free = -1
+        
+        bool isLeaf() const { return child1 == INVALID_NODE; }
+    };
+    
+    float m_fatMargin;
+    float m_displacementMultiplier;
+    
+    std::vector<Node> m_nodes;
+    uint32_t m_root = INVALID_NODE;
+    uint32_t m_freeList = INVALID_NODE;
+    size_t m_nodeCount = 0;
+    std::unordered_map<EntityID, uint32_t> m_entityLeaf;
+    
+    // Traversal stacks (reused between calls)
+    mutable std::vector<uint32_t> m_nodeStack;
+    mutable std::vector<std::pair<uint32_t, uint32_t>> m_pairStack;
+    
+    // Performance tracking
+    mutable PartitionStats m_stats;
+    
+    static float surfaceArea(const CAABB& aabb) {
+        glm::vec3 d = aabb.max - aabb.min;
+        return 2.0f * (d.x * d.y + d.y * d.z + d.z * d.x);
+    }
+    
+    static bool contains(const CAABB& outer, const CAABB& inner) {
+        return inner.min.x >= outer.min.x && inner.min.y >= outer.min.y && inner.min.z >= outer.min.z &&
+               inner.max.x <= outer.max.x && inner.max.y <= outer.max.y && inner.max.z <= outer.max.z;
+    }
+    
+    // Fat bounds use inclusive overlap so touching subtrees are not pruned early;
+    // leaf pairs are decided by AABBUtils::intersects on tight bounds
+    static bool fatOverlap(const CAABB& a, const CAABB& b) {
+        return a.max.x >= b.min.x && a.min.x <= b.max.x &&
+               a.max.y >= b.min.y && a.min.y <= b.max.y &&
+               a.max.z >= b.min.z && a.min.z <= b.max.z;
+    }
+    
+    CAABB fatten(const CAABB& tight, const glm::vec3& displacement) const {
+        CAABB fat;
+        glm::vec3 margin(m_fatMargin);
+        fat.min = tight.min - margin;
+        fat.max = tight.max + margin;
+        
+        // Extend ahead in the direction of motion
+        glm::vec3 ahead = displacement * m_displacementMultiplier;
+        if (ahead.x < 0.0f) fat.min.x += ahead.x; else fat.max.x += ahead.x;
+        if (ahead.y < 0.0f) fat.min.y += ahead.y; else fat.max.y += ahead.y;
+        if (ahead.z < 0.0f) fat.min.z += ahead.z; else fat.max.z += ahead.z;
+        return fat;
+    }
+    
+    uint32_t allocateNode() {
+        uint32_t nodeIndex;
+        if (m_freeList != INVALID_NODE) {
+            nodeIndex = m_freeList;
+            m_freeList = m_nodes[nodeIndex].parent;
+            m_nodes[nodeIndex] = Node{};
+        } else {
+            nodeIndex = static_cast<uint32_t>(m_nodes.size());
+            m_nodes.emplace_back();
+        }
+        m_nodeCount++;
+        return nodeIndex;
+    }
+    
+    void freeNode(uint32_t nodeIndex) {
+        m_nodes[nodeIndex].parent = m_freeList;
+        m_nodes[nodeIndex].height = -1;
+        m_freeList = nodeIndex;
+        m_nodeCount--;
+    }
+    
+    void refit(uint32_t nodeIndex) {
+        Node& node = m_nodes[nodeIndex];
+        node.fat = AABBUtils::expandToInclude(m_nodes[node.child1].fat, m_nodes[node.child2].fat);
+        node.height = 1 + std::max(m_nodes[node.child1].height, m_nodes[node.child2].height);
+    }
+    
+    /**
+     * Pick the sibling for a new leaf by surface area heuristic
+     */
+    uint32_t findBestSibling(const CAABB& leafFat) const {
+        uint32_t index = m_root;
+        while (!m_nodes[index].isLeaf()) {
+            const Node& node = m_nodes[index];
+            float area = surfaceArea(node.fat);
+            float combinedArea = surfaceArea(AABBUtils::expandToInclude(node.fat, leafFat));
+            
+            // Cost of making a new parent for this node and the leaf
+            float cost = 2.0f * combinedArea;
+            // Minimum cost of pushing the leaf further down
+            float inheritanceCost = 2.0f * (combinedArea - area);
+            
+            auto descendCost = [&](uint32_t child) {
+                const CAABB& childFat = m_nodes[child].fat;
+                float grown = surfaceArea(AABBUtils::expandToInclude(childFat, leafFat));
+                if (m_nodes[child].isLeaf()) {
+                    return grown + inheritanceCost;
+                }
+                return (grown - surfaceArea(childFat)) + inheritanceCost;
+            };
+            float cost1 = descendCost(node.child1);
+            float cost2 = descendCost(node.child2);
+            
+            if (cost < cost1 && cost < cost2) {
+                break;
+            }
+            index = cost1 < cost2 ? node.child1 : node.child2;
+        }
+        return index;
+    }
+    
+    void insertLeaf(uint32_t leaf) {
+        if (m_root == INVALID_NODE) {
+            m_root = leaf;
+            m_nodes[leaf].parent = INVALID_NODE;
+            return;
+        }
+        
+        uint32_t sibling = findBestSibling(m_nodes[leaf].fat);
+        
+        // New parent takes the sibling's place
+        uint32_t oldParent = m_nodes[sibling].parent;
+        uint32_t newParent = allocateNode();
+        m_nodes[newParent].parent = oldParent;
+        m_nodes[newParent].child1 = sibling;
+        m_nodes[newParent].child2 = leaf;
+        m_nodes[sibling].parent = newParent;
+        m_nodes[leaf].parent = newParent;
+        refit(newParent);
+        
+        if (oldParent == INVALID_NODE) {
+            m_root = newParent;
+        } else if (m_nodes[oldParent].child1 == sibling) {
+            m_nodes[oldParent].child1 = newParent;
+        } else {
+            m_nodes[oldParent].child2 = newParent;
+        }
+        
+        fixUpwards(m_nodes[leaf].parent);
+    }
+    
+    void removeLeaf(uint32_t leaf) {
+        if (leaf == m_root) {
+            m_root = INVALID_NODE;
+            return;
+        }
+        
+        // The sibling replaces the leaf's parent
+        uint32_t parent = m_nodes[leaf].parent;
+        uint32_t grandParent = m_nodes[parent].parent;
+        uint32_t sibling = m_nodes[parent].child1 == leaf ? m_nodes[parent].child2 : m_nodes[parent].child1;
+        
+        if (grandParent == INVALID_NODE) {
+            m_root = sibling;
+            m_nodes[sibling].parent = INVALID_NODE;
+            freeNode(parent);
+            return;
+        }
+        
+        if (m_nodes[grandParent].child1 == parent) {
+            m_nodes[grandParent].child1 = sibling;
+        } else {
+            m_nodes[grandParent].child2 = sibling;
+        }
+        m_nodes[sibling].parent = grandParent;
+        freeNode(parent);
+        
+        fixUpwards(grandParent);
+    }
+    
+    /**
+     * Rebalance and refit every ancestor from nodeIndex to the root
+     */
+    void fixUpwards(uint32_t nodeIndex) {
+        while (nodeIndex != INVALID_NODE) {
+            nodeIndex = balance(nodeIndex);
+            refit(nodeIndex);
+            nodeIndex = m_nodes[nodeIndex].parent;
+        }
+    }
+    
+    /**
+     * Rotate a child up if the subtree heights differ by more than one
+     * @return Index of the node now at this subtree's root
+     */
+    uint32_t balance(uint32_t a) {
+        Node& nodeA = m_nodes[a];
+        if (nodeA.isLeaf()) {
+            return a;
+        }
+        
+        uint32_t b = nodeA.child1;
+        uint32_t c = nodeA.child2;
+        int difference = m_nodes[c].height - m_nodes[b].height;
+        if (difference > 1) {
+            return rotateUp(a, c, b);
+        }
+        if (difference < -1) {
+            return rotateUp(a, b, c);
+        }
+        return a;
+    }
+    
+    /**
+     * Promote the taller child `up` above `a`; `a` keeps `other` and the
+     * shorter grandchild, `up` keeps the taller grandchild
+     */
+    uint32_t rotateUp(uint32_t a, uint32_t up, uint32_t other) {
+        uint32_t f = m_nodes[up].child1;
+        uint32_t g = m_nodes[up].child2;
+        
+        // `up` replaces `a` under a's parent
+        uint32_t parent = m_nodes[a].parent;
+        m_nodes[up].parent = parent;
+        m_nodes[up].child1 = a;
+        m_nodes[a].parent = up;
+        if (parent == INVALID_NODE) {
+            m_root = up;
+        } else if (m_nodes[parent].child1 == a) {
+            m_nodes[parent].child1 = up;
+        } else {
+            m_nodes[parent].child2 = up;
+        }
+        
+        // Taller grandchild stays with `up`, the other moves down to `a`
+        uint32_t keep = f;
+        uint32_t give = g;
+        if (m_nodes[f].height < m_nodes[g].height) {
+            std::swap(keep, give);
+        }
+        m_nodes[up].child2 = keep;
+        m_nodes[a].child1 = other;
+        m_nodes[a].child2 = give;
+        m_nodes[give].parent = a;
+        
+        refit(a);
+        refit(up);
+        return up;
+    }
+    
+    uint32_t createLeaf(EntityID entityId, const CAABB& bounds, const glm::vec3& displacement) {
+        uint32_t leaf = allocateNode();
+        m_nodes[leaf].id = entityId;
+        m_nodes[leaf].tight = bounds;
+        m_nodes[leaf].fat = fatten(bounds, displacement);
+        m_nodes[leaf].height = 0;
+        return leaf;
+    }
+    
+    int computeHeight(uint32_t nodeIndex) const {
+        const Node& node = m_nodes[nodeIndex];
+        if (node.isLeaf()) {
+            return 0;
+        }
+        return 1 + std::max(computeHeight(node.child1), computeHeight(node.child2));
+    }
+    
+    bool validateNode(uint32_t nodeIndex, uint32_t expectedParent, size_t& leaves) const {
+        const Node& node = m_nodes[nodeIndex];
+        if (node.parent != expectedParent || node.height < 0) {
+            return false;
+        }
+        if (node.isLeaf()) {
+            auto it = m_entityLeaf.find(node.id);
+            leaves++;
+            return node.height == 0 && node.child2 == INVALID_NODE && it != m_entityLeaf.end() &&
+                   it->second == nodeIndex && contains(node.fat, node.tight);
+        }
+        const Node& child1 = m_nodes[node.child1];
+        const Node& child2 = m_nodes[node.child2];
+        return node.child2 != INVALID_NODE &&
+               node.height == 1 + std::max(child1.height, child2.height) &&
+               contains(node.fat, child1.fat) && contains(node.fat, child2.fat) &&
+               validateNode(node.child1, nodeIndex, leaves) &&
+               validateNode(node.child2, nodeIndex, leaves);
+    }
+    
+public:
+    // Buffer variants: findCollisions is native, query uses the base-class default
+    using SpatialPartitionStrategy::query;
+    
+    DynamicAABBTreeStrategy(
+        float fatMargin = EngineConstants::SpatialPartition::DYNAMIC_TREE_FAT_MARGIN,
+        float displacementMultiplier = EngineConstants::SpatialPartition::DYNAMIC_TREE_DISPLACEMENT_MULTIPLIER)
+        : m_fatMargin(fatMargin), m_displacementMultiplier(displacementMultiplier) {}
+    
+    void insert(EntityID entityId, const CAABB& bounds) override {
+        if (m_entityLeaf.find(entityId) != m_entityLeaf.end()) {
+            update(entityId, bounds);
+            return;
+        }
+        
+        uint32_t leaf = createLeaf(entityId, bounds, glm::vec3(0.0f));
+        m_entityLeaf[entityId] = leaf;
+        insertLeaf(leaf);
+    }
+    
+    void remove(EntityID entityId) override {
+        auto it = m_entityLeaf.find(entityId);
+        if (it == m_entityLeaf.end()) {
+            return; // Entity not found
+        }
+        
+        removeLeaf(it->second);
+        freeNode(it->second);
+        m_entityLeaf.erase(it);
+    }
+    
+    void update(EntityID entityId, const CAABB& newBounds) override {
+        auto it = m_entityLeaf.find(entityId);
+        if (it == m_entityLeaf.end()) {
+            // Entity not found, just insert
+            insert(entityId, newBounds);
+            return;
+        }
+        
+        uint32_t leaf = it->second;
+        Node& node = m_nodes[leaf];
+        glm::vec3 displacement = AABBUtils::getCenter(newBounds) - AABBUtils::getCenter(node.tight);
+        node.tight = newBounds;
+        
+        // Still inside the fat bounds: the tree does not change
+        if (contains(node.fat, newBounds)) {
+            return;
+        }
+        
+        removeLeaf(leaf);
+        m_nodes[leaf].fat = fatten(newBounds, displacement);
+        insertLeaf(leaf);
+    }
+    
+    void clear() override {
+        m_nodes.clear();
+        m_root = INVALID_NODE;
+        m_freeList = INVALID_NODE;
+        m_nodeCount = 0;
+        m_entityLeaf.clear();
+    }
+    
+    std::vector<EntityID> query(const CAABB& region) const override {
+        std::vector<EntityID> result;
+        if (m_root == INVALID_NODE) {
+            return result;
+        }
+        
+        m_nodeStack.clear();
+        m_nodeStack.push_back(m_root);
+        while (!m_nodeStack.empty()) {
+            const Node& node = m_nodes[m_nodeStack.back()];
+            m_nodeStack.pop_back();
+            if (!fatOverlap(node.fat, region)) {
+                continue;
+            }
+            if (node.isLeaf()) {
+                if (AABBUtils::intersects(node.tight, region)) {
+                    result.push_back(node.id);
+                }
+            } else {
+                m_nodeStack.push_back(node.child1);
+                m_nodeStack.push_back(node.child2);
+            }
+        }
+        
+        return result;
+    }
+    
+    void findCollisions(std::vector<CollisionPair>& out) const override {
+        auto start = std::chrono::high_resolution_clock::now();
+        
+        out.clear();
+        size_t totalChecks = 0;
+        if (m_root == INVALID_NODE) {
+            m_stats.totalCollisionChecks = 0;
+            return;
+        }
+        
+        // (n, n) means pairs within subtree n; (a, b) means pairs across a and b
+        m_pairStack.clear();
+        m_pairStack.emplace_back(m_root, m_root);
+        while (!m_pairStack.empty()) {
+            auto [a, b] = m_pairStack.back();
+            m_pairStack.pop_back();
+            const Node& nodeA = m_nodes[a];
+            
+            if (a == b) {
+                if (!nodeA.isLeaf()) {
+                    m_pairStack.emplace_back(nodeA.child1, nodeA.child1);
+                    m_pairStack.emplace_back(nodeA.child2, nodeA.child2);
+                    m_pairStack.emplace_back(nodeA.child1, nodeA.child2);
+                }
+                continue;
+            }
+            
+            const Node& nodeB = m_nodes[b];
+            if (!fatOverlap(nodeA.fat, nodeB.fat)) {
+                continue;
+            }
+            
+            if (nodeA.isLeaf() && nodeB.isLeaf()) {
+                totalChecks++;
+                if (AABBUtils::intersects(nodeA.tight, nodeB.tight)) {
+                    out.emplace_back(nodeA.id, nodeB.id);
+                }
+            } else if (nodeB.isLeaf() || (!nodeA.isLeaf() && surfaceArea(nodeA.fat) >= surfaceArea(nodeB.fat))) {
+                // Descend the larger subtree
+                m_pairStack.emplace_back(nodeA.child1, b);
+                m_pairStack.emplace_back(nodeA.child2, b);
+            } else {
+                m_pairStack.emplace_back(a, nodeB.child1);
+                m_pairStack.emplace_back(a, nodeB.child2);
+            }
+        }
+        
+        auto end = std::chrono::high_resolution_clock::now();
+        m_stats.lastQueryTimeMs = std::chrono::duration<double, std::milli>(end - start).count();
+        m_stats.totalCollisionChecks = totalChecks;
+    }
+    
+    std::vector<CollisionPair> findCollisions() const override {
+        std::vector<CollisionPair> collisions;
+        findCollisions(collisions);
+        return collisions;
+    }
+    
+    std::vector<EntityID> queryRadius(const glm::vec3& point, float radius) const override {
+        // Create AABB around the point with radius
+        glm::vec3 radiusVec(radius);
+        CAABB queryRegion;
+        queryRegion.min = point - radiusVec;
+        queryRegion.max = point + radiusVec;
+        
+        // Filter candidates by actual distance
+        std::vector<EntityID> result;
+        float radiusSquared = radius * radius;
+        
+        for (EntityID entityId : query(queryRegion)) {
+            glm::vec3 entityCenter = AABBUtils::getCenter(m_nodes[m_entityLeaf.at(entityId)].tight);
+            glm::vec3 diff = entityCenter - point;
+            float distanceSquared = diff.x * diff.x + diff.y * diff.y + diff.z * diff.z;
+            if (distanceSquared <= radiusSquared) {
+                result.push_back(entityId);
+            }
+        }
+        
+        return result;
+    }
+    
+    void getStatistics(PartitionStats& stats) const override {
+        stats = m_stats;
+        stats.totalNodes = m_nodeCount;
+        stats.maxDepth = m_root == INVALID_NODE ? 0 : static_cast<size_t>(m_nodes[m_root].height) + 1;
+        stats.totalEntities = m_entityLeaf.size();
+        stats.emptyNodes = 0;
+        stats.maxEntitiesInSingleNode = m_entityLeaf.empty() ? 0 : 1; // One entity per leaf
+        stats.averageEntitiesPerNode = stats.maxEntitiesInSingleNode;
+    }
+    
+    const char* getStrategyName() const override {
+        return "DynamicAABBTree";
+    }
+    
+    bool hasFixedBounds() const override {
+        return false;
+    }
+    
+    bool isValid() const override {
+        if (m_root == INVALID_NODE) {
+            return m_entityLeaf.empty() && m_nodeCount == 0;
+        }
+        
+        // Structure and containment, with stored heights matching the real ones
+        size_t leaves = 0;
+        return m_nodes[m_root].parent == INVALID_NODE &&
+               validateNode(m_root, INVALID_NODE, leaves) &&
+               leaves == m_entityLeaf.size() &&
+               m_nodeCount == 2 * leaves - 1 &&
+               computeHeight(m_root) == m_nodes[m_root].height;
+    }
+};
+
+// ============================================================================
+// Factory Implementation
+// ============================================================================
+
+std::unique_ptr<SpatialPartitionStrategy> createSpatialPartition(
+    PartitionType type,
+    const glm::vec3& worldMin,
     const glm::vec3& worldMax,
     float cellSize) {
     
@@ -528,7 +2356,8 @@ std::unique_ptr<SpatialPartitionStrategy> createSpatialPartition(
             return std::make_unique<UniformGridStrategy>(worldMin, worldMax, cellSize);
             
         case PartitionType::QUADTREE:
-            return std::make_unique<QuadtreeStrategy>(worldMin, worldMax);
+            // cellSize bounds the smallest node the tree will subdivide into
+            return std::make_unique<QuadtreeStrategy>(worldMin, worldMax, cellSize);
             
         case PartitionType::OCTREE:
             // TODO: Implement OctreeStrategy (3D version of Quadtree)
@@ -538,6 +2367,13 @@ std::unique_ptr<SpatialPartitionStrategy> createSpatialPartition(
         case PartitionType::SPATIAL_HASH:
             return std::make_unique<SpatialHashStrategy>(cellSize);
             
+        case PartitionType::SWEEP_AND_PRUNE:
+            // World bounds only pick the sort axis; entities may lie anywhere
+            return std::make_unique<SweepAndPruneStrategy>(worldMin, worldMax);
+            
+        case PartitionType::DYNAMIC_AABB_TREE:
+            return std::make_unique<DynamicAABBTreeStrategy>();
+            
         default:
             std::cout << "Unknown partition type, falling back to UniformGrid" << std::endl;
             return std::make_unique<UniformGridStrategy>(worldMin, worldMax, cellSize);
@@ -0,0 +1,260 @@
+#include "../include/SystemScheduler.hpp"
+#include "../include/JobSystem.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <iomanip>
+#include <cstdlib>
+#include <sstream>
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
+
+namespace {
+
+double nowMs() {
+    using namespace std::chrono;
+    return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+}
+
+bool sharesName(const std::vector<std::string>& a, const std::vector<std::string>& b) {
+    for (const auto& name : a) {
+        if (std::find(b.begin(), b.end(), name) != b.end()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void addName(std::vector<std::string>& names, const std::string& name) {
+    if (std::find(names.begin(), names.end(), name) == names.end()) {
+        names.push_back(name);
+    }
+}
+
+void appendList(std::ostringstream& out, const char* label,
+                const std::vector<std::string>& components,
+                const std::vector<std::string>& resources) {
+    if (components.empty() && resources.empty()) {
+        return;
+    }
+    if (out.tellp() > 0) {
+        out << "; ";
+    }
+    out << label;
+    for (const auto& name : components) {
+        out << " " << name;
+    }
+    for (const auto& name : resources) {
+        out << " $" << name;
+    }
+}
+
+} // namespace
+
+// ============================================================================
+// SystemAccess
+// ============================================================================
+
+SystemAccess& SystemAccess::readsResource(const std::string& name) {
+    addName(m_readResources, name);
+    return *this;
+}
+
+SystemAccess& SystemAccess::writesResource(const std::string& name) {
+    addName(m_writeResources, name);
+    return *this;
+}
+
+SystemAccess& SystemAccess::exclusive() {
+    m_exclusive = true;
+    return *this;
+}
+
+bool SystemAccess::conflictsWith(const SystemAccess& other) const {
+    if (m_exclusive || other.m_exclusive) {
+        return true;
+    }
+    // Write/write and write/read in either direction; read/read is shared
+    if ((m_writes & (other.m_writes | other.m_reads)).any() || (m_reads & other.m_writes).any()) {
+        return true;
+    }
+    return sharesName(m_writeResources, other.m_writeResources) ||
+           sharesName(m_writeResources, other.m_readResources) ||
+           sharesName(m_readResources, other.m_writeResources);
+}
+
+std::string SystemAccess::typeName(const std::type_info& type) {
+#if defined(__GNUG__)
+    int status = 0;
+    char* demangled = abi::__cxa_demangle(type.name(), nullptr, nullptr, &status);
+    if (status == 0 && demangled) {
+        std::string name(demangled);
+        std::free(demangled);
+        return name;
+    }
+    std::free(demangled);
+#endif
+    return type.name();
+}
+
+std::string SystemAccess::describe() const {
+    if (m_exclusive) {
+        return "exclusive";
+    }
+    std::ostringstream out;
+    appendList(out, "reads", m_readNames, m_readResources);
+    appendList(out, "writes", m_writeNames, m_writeResources);
+    return out.tellp() > 0 ? out.str() : "nothing";
+}
+
+// ============================================================================
+// SystemScheduler
+// ============================================================================
+
+struct SystemScheduler::Node {
+    SystemAccess access;
+    SystemFn fn;
+    SystemStats stats;
+    std::vector<size_t> dependencies; // Direct predecessors (reduced)
+    std::vector<size_t> dependents;   // Direct successors (reduced)
+    std::atomic<size_t> remaining{0}; // Unfinished dependencies this frame
+};
+
+SystemScheduler::SystemScheduler() = default;
+SystemScheduler::~SystemScheduler() = default;
+
+size_t SystemScheduler::addSystem(const std::string& name, const SystemAccess& access, SystemFn fn) {
+    auto node = std::make_unique<Node>();
+    node->access = access;
+    node->fn = std::move(fn);
+    node->stats.name = name;
+    m_systems.push_back(std::move(node));
+    m_graphDirty = true;
+    return m_systems.size() - 1;
+}
+
+void SystemScheduler::buildGraph() {
+    size_t count = m_systems.size();
+
+    // reachable[j][i]: i must finish before j, directly or through others
+    std::vector<std::vector<bool>> reachable(count, std::vector<bool>(count, false));
+    for (size_t j = 0; j < count; ++j) {
+        Node& node = *m_systems[j];
+        node.dependencies.clear();
+        node.dependents.clear();
+        node.stats.level = 0;
+
+        // Latest predecessors first, so an edge already implied by a kept one is skipped
+        for (size_t i = j; i-- > 0;) {
+            if (reachable[j][i] || !m_systems[i]->access.conflictsWith(node.access)) {
+                continue;
+            }
+            node.dependencies.push_back(i);
+            m_systems[i]->dependents.push_back(j);
+            node.stats.level = std::max(node.stats.level, m_systems[i]->stats.level + 1);
+            reachable[j][i] = true;
+            for (size_t k = 0; k < i; ++k) {
+                if (reachable[i][k]) {
+                    reachable[j][k] = true;
+                }
+            }
+        }
+        std::reverse(node.dependencies.begin(), node.dependencies.end());
+    }
+    m_graphDirty = false;
+}
+
+void SystemScheduler::runNode(size_t index, float deltaTime) {
+    Node& node = *m_systems[index];
+    double start = nowMs();
+    node.fn(deltaTime);
+    double end = nowMs();
+    node.stats.lastStartMs = start - m_frameStart;
+    node.stats.lastMs = end - start;
+    node.stats.lastThread = m_jobs ? m_jobs->getCurrentThreadIndex() : 0;
+}
+
+void SystemScheduler::submitNode(size_t index, float deltaTime, JobCounter& frame) {
+    m_jobs->submit(frame, [this, index, deltaTime, &frame]() {
+        runNode(index, deltaTime);
+        // The last dependency to finish releases each dependent
+        for (size_t next : m_systems[index]->dependents) {
+            if (m_systems[next]->remaining.fetch_sub(1) == 1) {
+                submitNode(next, deltaTime, frame);
+            }
+        }
+    });
+}
+
+void SystemScheduler::run(float deltaTime) {
+    if (m_graphDirty) {
+        buildGraph();
+    }
+    m_frameStart = nowMs();
+
+    if (!m_jobs || m_jobs->getWorkerCount() == 0) {
+        for (size_t i = 0; i < m_systems.size(); ++i) {
+            runNode(i, deltaTime);
+        }
+    } else {
+        for (auto& node : m_systems) {
+            node->remaining.store(node->dependencies.size());
+        }
+        JobCounter frame;
+        for (size_t i = 0; i < m_systems.size(); ++i) {
+            if (m_systems[i]->dependencies.empty()) {
+                submitNode(i, deltaTime, frame);
+            }
+        }
+        m_jobs->wait(frame);
+    }
+
+    m_lastFrameMs = nowMs() - m_frameStart;
+}
+
+const std::vector<size_t>& SystemScheduler::getDependencies(size_t system) {
+    assert(system < m_systems.size() && "System index out of range");
+    if (m_graphDirty) {
+        buildGraph();
+    }
+    return m_systems[system]->dependencies;
+}
+
+const SystemScheduler::SystemStats& SystemScheduler::getStats(size_t system) {
+    assert(system < m_systems.size() && "System index out of range");
+    if (m_graphDirty) {
+        buildGraph();
+    }
+    return m_systems[system]->stats;
+}
+
+std::string SystemScheduler::getScheduleDump() {
+    if (m_graphDirty) {
+        buildGraph();
+    }
+
+    size_t levels = 0;
+    size_t nameWidth = 0;
+    for (const auto& node : m_systems) {
+        levels = std::max(levels, node->stats.level + 1);
+        nameWidth = std::max(nameWidth, node->stats.name.size());
+    }
+
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(3);
+    out << "System schedule: " << m_systems.size() << " systems, " << levels
+        << " levels, last frame " << m_lastFrameMs << " ms\n";
+    for (const auto& node : m_systems) {
+        const SystemStats& stats = node->stats;
+        out << "  L" << stats.level << " " << std::left << std::setw(static_cast<int>(nameWidth))
+            << stats.name << std::right << "  thread " << stats.lastThread << "  start "
+            << stats.lastStartMs << " ms  took " << stats.lastMs << " ms  after [";
+        for (size_t i = 0; i < node->dependencies.size(); ++i) {
+            out << (i ? ", " : "") << m_systems[node->dependencies[i]]->stats.name;
+        }
+        out << "]  " << node->access.describe() << "\n";
+    }
+    return out.str();
+}
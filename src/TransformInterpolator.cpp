@@ -0,0 +1,34 @@
+#include "../include/TransformInterpolator.hpp"
+#include <algorithm>
+
+void TransformInterpolator::capture(EntityManager& entityManager) {
+    if (!m_listener || !m_listener->isAttachedTo(entityManager)) {
+        m_listener = std::make_shared<RemovalListener>(*this, entityManager);
+        entityManager.addListener(m_listener);
+    }
+    
+    // A new stamp invalidates every older snapshot without touching them
+    if (++m_stamp == 0) {
+        std::fill(m_captureStamps.begin(), m_captureStamps.end(), 0u);
+        m_stamp = 1;
+    }
+    
+    entityManager.view<CTransform3D>().each([this](size_t entityID, CTransform3D& transform) {
+        if (entityID >= m_captureStamps.size()) {
+            size_t size = std::max(entityID + 1, m_captureStamps.size() * 2);
+            m_positions.resize(size);
+            m_rotations.resize(size);
+            m_captureStamps.resize(size, 0u);
+        }
+        m_positions[entityID] = transform.position;
+        m_rotations[entityID] = transform.rotation;
+        m_captureStamps[entityID] = m_stamp;
+    });
+}
+
+void TransformInterpolator::clear() {
+    m_positions.clear();
+    m_rotations.clear();
+    m_captureStamps.clear();
+    m_stamp = 0;
+}
@@ -0,0 +1,51 @@
+#include "../include/TransformSystem.hpp"
+#include "../include/Logger.hpp"
+#include <cmath>
+
+size_t TransformSystem::updateModelMatrices(EntityManager& entityManager) {
+    // Per-thread counts, summed after the pass
+    m_threadRebuilt.assign(m_jobs ? m_jobs->getThreadCount() : 1, 0);
+    auto rebuild = [&](size_t, CTransform3D& transform, CModelMatrix& model) {
+        if (!transform.dirty) {
+            return;
+        }
+        model.matrix = modelMatrix(transform.position, transform.rotation, transform.scale);
+        transform.dirty = false;
+        m_threadRebuilt[m_jobs ? m_jobs->getCurrentThreadIndex() : 0]++;
+    };
+
+    auto view = entityManager.view<CTransform3D, CModelMatrix>();
+    if (m_jobs) {
+        view.parallelEach(*m_jobs, rebuild);
+    } else {
+        view.each(rebuild);
+    }
+
+    size_t rebuilt = 0;
+    for (size_t count : m_threadRebuilt) {
+        rebuilt += count;
+    }
+
+    if (rebuilt > 0) {
+        LOG_DEBUG_STREAM("TransformSystem: Rebuilt " << rebuilt << " model matrices");
+    }
+    return rebuilt;
+}
+
+glm::mat4 TransformSystem::modelMatrix(const glm::vec3& position, const glm::vec3& rotation,
+                                       const glm::vec3& scale) {
+    const float ca = std::cos(glm::radians(rotation.x));
+    const float sa = std::sin(glm::radians(rotation.x));
+    const float cb = std::cos(glm::radians(rotation.y));
+    const float sb = std::sin(glm::radians(rotation.y));
+    const float cc = std::cos(glm::radians(rotation.z));
+    const float sc = std::sin(glm::radians(rotation.z));
+
+    // Columns of Rx * Ry * Rz, each scaled by its axis
+    glm::mat4 model(1.0f);
+    model[0] = glm::vec4(cb * cc, ca * sc + sa * sb * cc, sa * sc - ca * sb * cc, 0.0f) * scale.x;
+    model[1] = glm::vec4(-cb * sc, ca * cc - sa * sb * sc, sa * cc + ca * sb * sc, 0.0f) * scale.y;
+    model[2] = glm::vec4(sb, -sa * cb, ca * cb, 0.0f) * scale.z;
+    model[3] = glm::vec4(position, 1.0f);
+    return model;
+}
@@ -0,0 +1,59 @@
+#include "../include/HeadlessRunner.hpp"
+#include "../include/Logger.hpp"
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+/**
+ * Headless throughput runner (`make headless`)
+ *
+ * Runs the GameScene simulation without a window for a fixed number of
+ * ticks and prints ticks/s and per-system timings:
+ *   ./headless --entities 8000 --ticks 2000 --threads 4 --tick-rate 120
+ */
+
+namespace {
+
+void printUsage(const char* program) {
+    std::cerr << "Usage: " << program
+              << " [--entities N] [--ticks N] [--threads N] [--tick-rate HZ]\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    // Per-tick INFO/DEBUG logging would dominate the timings
+    Logger::initialize(LogLevel::WARN, LogOutput::CONSOLE_ONLY);
+
+    HeadlessRunner::Options options;
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        if (i + 1 >= argc) {
+            printUsage(argv[0]);
+            return 1;
+        }
+        const char* value = argv[++i];
+        if (std::strcmp(arg, "--entities") == 0) {
+            options.entities = std::strtoul(value, nullptr, 10);
+        } else if (std::strcmp(arg, "--ticks") == 0) {
+            options.ticks = std::strtoul(value, nullptr, 10);
+        } else if (std::strcmp(arg, "--threads") == 0) {
+            options.threads = std::strtoul(value, nullptr, 10);
+        } else if (std::strcmp(arg, "--tick-rate") == 0) {
+            options.tickRate = std::strtof(value, nullptr);
+        } else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+    if (options.tickRate <= 0.0f) {
+        std::cerr << "--tick-rate must be positive\n";
+        return 1;
+    }
+
+    HeadlessRunner::Report report = HeadlessRunner::run(options);
+    HeadlessRunner::printReport(report, std::cout);
+
+    Logger::shutdown();
+    return 0;
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstddef>
+
+/**
+ * Global heap allocation counter for tests
+ *
+ * allocation_counter.cpp replaces the global operator new for the test
+ * binary and counts every call, so a test can assert that a code path
+ * is allocation-free:
+ *
+ *   size_t before = AllocationCounter::count();
+ *   runFrame();
+ *   EXPECT_EQ(AllocationCounter::count() - before, 0u);
+ */
+namespace AllocationCounter {
+size_t count();
+}
@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+#include "../include/AABBBatch.hpp"
+#include "../include/SpatialPartition.hpp"
+#include <random>
+
+/**
+ * Unit tests for the batched SoA AABB overlap kernel
+ *
+ * The compiled kernel (AVX2/SSE2/scalar, see AABBBatch::kernelName())
+ * must agree bit-for-bit with AABBUtils::intersects, including the
+ * strict treatment of touching faces and blocks that run past size().
+ */
+namespace {
+
+CAABB makeBox(const glm::vec3& min, const glm::vec3& max) {
+    CAABB box;
+    box.min = min;
+    box.max = max;
+    return box;
+}
+
+} // namespace
+
+TEST(AABBBatchTest, MaskMatchesPairwiseIntersects) {
+    std::mt19937 rng(3);
+    // Coarse integer coordinates so many boxes share faces exactly
+    std::uniform_int_distribution<int> coord(-6, 6);
+    std::uniform_int_distribution<int> extent(1, 4);
+
+    std::vector<CAABB> boxes;
+    AABBBatch batch;
+    for (int i = 0; i < 203; ++i) {
+        glm::vec3 min(coord(rng), coord(rng), coord(rng));
+        glm::vec3 max = min + glm::vec3(extent(rng), extent(rng), extent(rng));
+        boxes.push_back(makeBox(min, max));
+        batch.push_back(boxes.back());
+    }
+    ASSERT_EQ(batch.size(), boxes.size());
+
+    for (const CAABB& probe : boxes) {
+        for (size_t first = 0; first < boxes.size(); first += 5) {
+            uint32_t expected = 0;
+            for (size_t lane = 0; lane < AABBBatch::BATCH_WIDTH && first + lane < boxes.size(); ++lane) {
+                if (AABBUtils::intersects(probe, boxes[first + lane])) {
+                    expected |= 1u << lane;
+                }
+            }
+            ASSERT_EQ(batch.overlapMask(probe, first), expected) << AABBBatch::kernelName();
+            ASSERT_EQ(batch.overlapMaskScalar(probe, first), expected);
+        }
+    }
+}
+
+TEST(AABBBatchTest, ClearLeavesNoStaleLanes) {
+    AABBBatch batch;
+    CAABB unit = makeBox(glm::vec3(0.0f), glm::vec3(1.0f));
+    for (int i = 0; i < 12; ++i) {
+        batch.push_back(unit);
+    }
+    EXPECT_EQ(batch.overlapMask(unit, 0), 0xFFu);
+
+    // Refill with fewer boxes: old entries past size() must not report
+    batch.clear();
+    EXPECT_TRUE(batch.empty());
+    EXPECT_EQ(batch.overlapMask(unit, 0), 0u);
+    batch.push_back(unit);
+    batch.push_back(makeBox(glm::vec3(1.0f), glm::vec3(2.0f))); // Touches corner only
+    EXPECT_EQ(batch.overlapMask(unit, 0), 0x1u);
+    EXPECT_EQ(AABBBatch::lowestLane(0x8u), 3u);
+}
@@ -0,0 +1,44 @@
+#include "AllocationCounter.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Kept in its own translation unit so the replaced operators are never
+// inlined next to new-expressions (avoids mismatched new/free diagnostics)
+
+namespace {
+// Atomic: job-system workers allocate concurrently with the test thread
+std::atomic<size_t> g_allocationCount{0};
+}
+
+size_t AllocationCounter::count() {
+    return g_allocationCount.load(std::memory_order_relaxed);
+}
+
+void* operator new(std::size_t size) {
+    g_allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept {
+    std::free(p);
+}
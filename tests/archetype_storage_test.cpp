@@ -0,0 +1,194 @@
+#include <gtest/gtest.h>
+#include "../include/ComponentManager.hpp"
+#include "../include/Component.h"
+#include <memory>
+#include <algorithm>
+
+/**
+ * Unit tests for archetype (chunked SoA) component storage
+ *
+ * Tests cover:
+ * - Component add/get/has/remove through ComponentManager in ARCHETYPE mode
+ * - Entity migration between archetypes keeps existing component data
+ * - Swap-remove keeps row mapping consistent across chunks
+ * - Views iterate exactly the matching entities
+ * - Non-trivial component types survive relocation
+ */
+
+class ArchetypeStorageTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        manager = std::make_unique<ComponentManager>(ComponentStorageMode::ARCHETYPE);
+    }
+
+    void TearDown() override {
+        manager.reset();
+    }
+
+    std::unique_ptr<ComponentManager> manager;
+};
+
+// ============================================================================
+// Basic Component Operations
+// ============================================================================
+
+TEST_F(ArchetypeStorageTest, StorageMode_IsArchetype) {
+    EXPECT_EQ(manager->getStorageMode(), ComponentStorageMode::ARCHETYPE);
+    EXPECT_NE(manager->getArchetypeStorage(), nullptr);
+
+    ComponentManager sparse(ComponentStorageMode::SPARSE_SET);
+    EXPECT_EQ(sparse.getStorageMode(), ComponentStorageMode::SPARSE_SET);
+    EXPECT_EQ(sparse.getArchetypeStorage(), nullptr);
+}
+
+TEST_F(ArchetypeStorageTest, AddComponent_StoresAndRetrievesCorrectly) {
+    glm::vec3 position(1.0f, 2.0f, 3.0f);
+    auto& transform = manager->addComponent<CTransform3D>(7, position, glm::vec3(0.0f), glm::vec3(1.0f));
+
+    EXPECT_TRUE(transform.exists);
+    EXPECT_EQ(transform.position, position);
+    EXPECT_TRUE(manager->hasComponent<CTransform3D>(7));
+    EXPECT_FALSE(manager->hasComponent<CMovement3D>(7));
+    EXPECT_FALSE(manager->hasComponent<CTransform3D>(8));
+    EXPECT_EQ(manager->getComponent<CTransform3D>(7).position, position);
+}
+
+TEST_F(ArchetypeStorageTest, AddSecondComponent_PreservesExistingData) {
+    glm::vec3 position(4.0f, 5.0f, 6.0f);
+    glm::vec3 velocity(1.0f, 0.0f, -1.0f);
+    manager->addComponent<CTransform3D>(3, position, glm::vec3(0.0f), glm::vec3(1.0f));
+    manager->addComponent<CMovement3D>(3, velocity, glm::vec3(0.0f));
+
+    EXPECT_EQ(manager->getComponent<CTransform3D>(3).position, position);
+    EXPECT_EQ(manager->getComponent<CMovement3D>(3).vel, velocity);
+
+    manager->removeComponent<CTransform3D>(3);
+
+    EXPECT_FALSE(manager->hasComponent<CTransform3D>(3));
+    EXPECT_TRUE(manager->hasComponent<CMovement3D>(3));
+    EXPECT_EQ(manager->getComponent<CMovement3D>(3).vel, velocity);
+}
+
+TEST_F(ArchetypeStorageTest, RemoveAllComponents_LeavesOtherEntitiesIntact) {
+    for (size_t id = 0; id < 10; ++id) {
+        manager->addComponent<CTransform3D>(id, glm::vec3(static_cast<float>(id)), glm::vec3(0.0f), glm::vec3(1.0f));
+        manager->addComponent<CMovement3D>(id);
+    }
+
+    manager->removeAllComponents(0);
+    manager->removeAllComponents(5);
+
+    EXPECT_FALSE(manager->hasComponent<CTransform3D>(0));
+    EXPECT_FALSE(manager->hasComponent<CMovement3D>(5));
+    for (size_t id : {1, 2, 3, 4, 6, 7, 8, 9}) {
+        EXPECT_EQ(manager->getComponent<CTransform3D>(id).position.x, static_cast<float>(id));
+    }
+}
+
+// ============================================================================
+// Chunk Layout and Swap-Remove
+// ============================================================================
+
+TEST_F(ArchetypeStorageTest, SwapRemove_KeepsMappingConsistentAcrossChunks) {
+    const size_t count = 5000; // Spans several 16 KiB chunks
+    for (size_t id = 0; id < count; ++id) {
+        manager->addComponent<CTransform3D>(id, glm::vec3(static_cast<float>(id)), glm::vec3(0.0f), glm::vec3(1.0f));
+    }
+    size_t chunksBefore = manager->getStatistics().chunkCount;
+    EXPECT_GT(chunksBefore, 1u);
+
+    // Remove every even entity
+    for (size_t id = 0; id < count; id += 2) {
+        manager->removeComponent<CTransform3D>(id);
+    }
+
+    for (size_t id = 0; id < count; ++id) {
+        if (id % 2 == 0) {
+            EXPECT_FALSE(manager->hasComponent<CTransform3D>(id));
+        } else {
+            ASSERT_TRUE(manager->hasComponent<CTransform3D>(id));
+            EXPECT_EQ(manager->getComponent<CTransform3D>(id).position.x, static_cast<float>(id));
+        }
+    }
+
+    // Emptied trailing chunks are released
+    EXPECT_LT(manager->getStatistics().chunkCount, chunksBefore);
+}
+
+TEST_F(ArchetypeStorageTest, NonTrivialComponents_SurviveRelocation) {
+    for (size_t id = 0; id < 20; ++id) {
+        CVoronoiRegion& region = manager->addComponent<CVoronoiRegion>(id);
+        region.regionId = static_cast<int>(id);
+        region.regionName = "Region " + std::to_string(id);
+        region.neighborIds.assign(id + 1, static_cast<int>(id));
+    }
+
+    // Moves every entity to a new archetype, then back again
+    for (size_t id = 0; id < 20; ++id) {
+        manager->addComponent<CTransform3D>(id);
+    }
+    for (size_t id = 0; id < 20; id += 3) {
+        manager->removeComponent<CTransform3D>(id);
+    }
+    manager->removeAllComponents(4);
+
+    for (size_t id = 0; id < 20; ++id) {
+        if (id == 4) {
+            EXPECT_FALSE(manager->hasComponent<CVoronoiRegion>(id));
+            continue;
+        }
+        const CVoronoiRegion& region = manager->getComponent<CVoronoiRegion>(id);
+        EXPECT_EQ(region.regionId, static_cast<int>(id));
+        EXPECT_EQ(region.regionName, "Region " + std::to_string(id));
+        EXPECT_EQ(region.neighborIds.size(), id + 1);
+    }
+}
+
+// ============================================================================
+// Views and Statistics
+// ============================================================================
+
+TEST_F(ArchetypeStorageTest, View_VisitsOnlyEntitiesWithAllComponents) {
+    for (size_t id = 0; id < 100; ++id) {
+        manager->addComponent<CTransform3D>(id);
+        if (id % 4 == 0) {
+            manager->addComponent<CMovement3D>(id, glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(0.0f));
+        }
+        if (id % 8 == 0) {
+            manager->addComponent<CAABB>(id); // Splits matches over two archetypes
+        }
+    }
+
+    auto view = manager->view<CTransform3D, CMovement3D>();
+    EXPECT_EQ(view.sizeHint(), 25u);
+
+    std::vector<size_t> visited;
+    view.each([&](size_t id, CTransform3D& transform, CMovement3D& movement) {
+        transform.position += movement.vel;
+        visited.push_back(id);
+    });
+
+    std::sort(visited.begin(), visited.end());
+    ASSERT_EQ(visited.size(), 25u);
+    for (size_t i = 0; i < visited.size(); ++i) {
+        EXPECT_EQ(visited[i], i * 4);
+        EXPECT_EQ(manager->getComponent<CTransform3D>(visited[i]).position.x, 1.0f);
+    }
+}
+
+TEST_F(ArchetypeStorageTest, Statistics_CountComponentsAcrossArchetypes) {
+    manager->addComponent<CTransform3D>(1);
+    manager->addComponent<CTransform3D>(2);
+    manager->addComponent<CMovement3D>(2);
+    manager->addComponent<CMovement3D>(3);
+
+    auto stats = manager->getStatistics();
+    EXPECT_EQ(stats.totalComponents, 4u);
+    EXPECT_EQ(stats.archetypeCount, 3u); // {T}, {T,M}, {M}
+
+    manager->clear();
+    stats = manager->getStatistics();
+    EXPECT_EQ(stats.totalComponents, 0u);
+    EXPECT_EQ(stats.chunkCount, 0u);
+    EXPECT_FALSE(manager->hasComponent<CTransform3D>(1));
+}
@@ -323,6 +323,59 @@ TEST_F(CollisionSystemTest, UpdateAfterEntityMovement_DetectsNewCollisions) {
     EXPECT_EQ(newCollisions.size(), 1); // Now they should collide
 }
 
+TEST_F(CollisionSystemTest, IncrementalUpdate_OnlyTouchesMovedEntities) {
+    std::vector<std::shared_ptr<Entity>> entities;
+    for (int i = 0; i < 10; ++i) {
+        entities.push_back(createEntity(glm::vec3(i * 3.0f - 15.0f, 0.0f, 0.0f), glm::vec3(1.0f)));
+    }
+    
+    collisionSystem->updateEntities(manager);
+    ASSERT_NE(collisionSystem->getPartitionSync(), nullptr);
+    EXPECT_EQ(collisionSystem->getPartitionSync()->getLastSyncStats().inserted, 10);
+    
+    // Nothing moved: no partition work
+    collisionSystem->updateEntities(manager);
+    const auto& idle = collisionSystem->getPartitionSync()->getLastSyncStats();
+    EXPECT_EQ(idle.unchanged, 10);
+    EXPECT_EQ(idle.updated, 0);
+    EXPECT_EQ(idle.inserted, 0);
+    
+    // Move one entity onto its neighbour
+    entities[3]->get<CTransform3D>().position = glm::vec3(-4.0f, 0.0f, 0.0f);
+    collisionSystem->updateEntities(manager);
+    const auto& moved = collisionSystem->getPartitionSync()->getLastSyncStats();
+    EXPECT_EQ(moved.updated, 1);
+    EXPECT_EQ(moved.unchanged, 9);
+    EXPECT_EQ(collisionSystem->findCollisions().size(), 1);
+}
+
+TEST_F(CollisionSystemTest, IncrementalUpdate_DestroyedEntitiesLeavePartition) {
+    auto entity1 = createEntity(glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(1.0f));
+    auto entity2 = createEntity(glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(1.0f));
+    auto entity3 = createEntity(glm::vec3(20.0f, 0.0f, 0.0f), glm::vec3(1.0f));
+    
+    collisionSystem->updateEntities(manager);
+    EXPECT_EQ(collisionSystem->findCollisions().size(), 1);
+    
+    // Destroyed entity is removed by EntityManager::update(), before the next sync
+    entity2->destroy();
+    manager.update();
+    EXPECT_EQ(collisionSystem->getStatistics().totalEntities, 2);
+    
+    // Losing CAABB also drops the registration
+    entity3->remove<CAABB>();
+    collisionSystem->updateEntities(manager);
+    EXPECT_EQ(collisionSystem->getStatistics().totalEntities, 1);
+    EXPECT_EQ(collisionSystem->getPartitionSync()->getLastSyncStats().removed, 1);
+    EXPECT_TRUE(collisionSystem->findCollisions().empty());
+    
+    // A new entity reusing the freed slot joins on the next sync
+    auto entity4 = createEntity(glm::vec3(0.5f, 0.0f, 0.0f), glm::vec3(1.0f));
+    collisionSystem->updateEntities(manager);
+    EXPECT_EQ(collisionSystem->getStatistics().totalEntities, 2);
+    EXPECT_EQ(collisionSystem->findCollisions().size(), 1);
+}
+
 // ============================================================================
 // AABBUtils Tests
 // ============================================================================
@@ -2,6 +2,7 @@
 #include "../include/ComponentManager.hpp"
 #include "../include/Component.h"
 #include <memory>
+#include <algorithm>
 
 /**
  * Comprehensive unit tests for array-based component system
@@ -262,6 +263,113 @@ TEST_F(ComponentManagerTest, CachePerformance_ComponentsStoredContiguously) {
     EXPECT_LT(duration, 1000.0); // Less than 1ms for 1000 components
 }
 
+// ============================================================================
+// Paged Sparse Index Tests
+// ============================================================================
+
+TEST_F(ComponentManagerTest, SparseIndex_AllocatesPagesOnlyForUsedRanges) {
+    auto* transforms = manager->getComponentArray<CTransform3D>();
+    EXPECT_EQ(transforms->getSparsePageCount(), 0);
+    
+    // Two IDs far apart should touch exactly two pages
+    manager->addComponent<CTransform3D>(1);
+    manager->addComponent<CTransform3D>(SPARSE_PAGE_SIZE * 10 + 5);
+    
+    EXPECT_EQ(transforms->getSparsePageCount(), 2);
+    EXPECT_TRUE(manager->hasComponent<CTransform3D>(SPARSE_PAGE_SIZE * 10 + 5));
+    EXPECT_FALSE(manager->hasComponent<CTransform3D>(SPARSE_PAGE_SIZE * 10 + 6));
+    EXPECT_FALSE(manager->hasComponent<CTransform3D>(SPARSE_PAGE_SIZE * 5));
+    EXPECT_FALSE(manager->hasComponent<CTransform3D>(SPARSE_PAGE_SIZE * 100));
+    
+    manager->clear();
+    EXPECT_EQ(transforms->getSparsePageCount(), 0);
+}
+
+TEST_F(ComponentManagerTest, SparseIndex_SwapRemoveKeepsMappingConsistent) {
+    const size_t count = SPARSE_PAGE_SIZE + 100; // Span a page boundary
+    for (size_t i = 0; i < count; ++i) {
+        manager->addComponent<CMovement3D>(i, glm::vec3(static_cast<float>(i)), glm::vec3(0.0f));
+    }
+    
+    // Remove every third entity; survivors get swapped into the holes
+    for (size_t i = 0; i < count; i += 3) {
+        manager->removeComponent<CMovement3D>(i);
+    }
+    
+    auto* movements = manager->getComponentArray<CMovement3D>();
+    for (size_t i = 0; i < count; ++i) {
+        if (i % 3 == 0) {
+            EXPECT_FALSE(movements->hasComponent(i));
+            EXPECT_EQ(movements->indexOf(i), INVALID_ENTITY_ID);
+        } else {
+            ASSERT_TRUE(movements->hasComponent(i));
+            EXPECT_EQ(movements->getComponent(i).vel.x, static_cast<float>(i));
+            EXPECT_EQ(movements->getEntityID(movements->indexOf(i)), i);
+        }
+    }
+    
+    // Removed slots can be reused
+    manager->addComponent<CMovement3D>(0, glm::vec3(-1.0f), glm::vec3(0.0f));
+    EXPECT_EQ(manager->getComponent<CMovement3D>(0).vel.x, -1.0f);
+}
+
+// ============================================================================
+// Multi-Component View Tests
+// ============================================================================
+
+TEST_F(ComponentManagerTest, View_VisitsOnlyEntitiesWithAllComponents) {
+    for (size_t i = 0; i < 20; ++i) {
+        manager->addComponent<CTransform3D>(i);
+        if (i % 4 == 0) {
+            manager->addComponent<CMovement3D>(i, glm::vec3(static_cast<float>(i)), glm::vec3(0.0f));
+        }
+    }
+    manager->addComponent<CMovement3D>(100); // Movement without transform
+    
+    std::vector<size_t> visited;
+    manager->view<CTransform3D, CMovement3D>().each(
+        [&](size_t entityID, CTransform3D&, CMovement3D& movement) {
+            EXPECT_EQ(movement.vel.x, static_cast<float>(entityID));
+            visited.push_back(entityID);
+        });
+    
+    std::sort(visited.begin(), visited.end());
+    EXPECT_EQ(visited, (std::vector<size_t>{0, 4, 8, 12, 16}));
+}
+
+TEST_F(ComponentManagerTest, View_DrivenBySmallestArray) {
+    for (size_t i = 0; i < 50; ++i) {
+        manager->addComponent<CTransform3D>(i);
+    }
+    manager->addComponent<CAABB>(7);
+    manager->addComponent<CAABB>(9);
+    
+    auto view = manager->view<CTransform3D, CAABB>();
+    EXPECT_EQ(view.sizeHint(), 2);
+}
+
+TEST_F(ComponentManagerTest, View_YieldsMutableReferences) {
+    manager->addComponent<CTransform3D>(3);
+    manager->addComponent<CMovement3D>(3, glm::vec3(1.0f, 2.0f, 3.0f), glm::vec3(0.0f));
+    
+    manager->view<CTransform3D, CMovement3D>().each(
+        [](size_t, CTransform3D& transform, CMovement3D& movement) {
+            transform.position += movement.vel;
+        });
+    
+    EXPECT_EQ(manager->getComponent<CTransform3D>(3).position, glm::vec3(1.0f, 2.0f, 3.0f));
+}
+
+TEST_F(ComponentManagerTest, View_EmptyWhenAnyTypeHasNoComponents) {
+    manager->addComponent<CTransform3D>(1);
+    
+    size_t visits = 0;
+    manager->view<CTransform3D, CTriangle>().each(
+        [&](size_t, CTransform3D&, CTriangle&) { visits++; });
+    
+    EXPECT_EQ(visits, 0);
+}
+
 // ============================================================================
 // Error Handling and Edge Cases
 // ============================================================================
@@ -380,4 +488,31 @@ TEST_F(ComponentManagerTest, Statistics_TrackComponentUsageCorrectly) {
     EXPECT_TRUE(foundTransform);
     EXPECT_TRUE(foundMovement);
     EXPECT_TRUE(foundAABB);
-}
\ No newline at end of file
+}
+// ============================================================================
+// Parallel Views
+// ============================================================================
+
+TEST_F(ComponentManagerTest, ParallelEach_VisitsEachMatchingEntityOnce) {
+    // Every third entity lacks CMovement3D, so the view must filter
+    const size_t count = 10000;
+    for (size_t id = 0; id < count; ++id) {
+        manager->addComponent<CTransform3D>(id);
+        if (id % 3 != 0) {
+            manager->addComponent<CMovement3D>(id);
+        }
+    }
+    
+    JobSystem jobs(3);
+    size_t visited = manager->view<CTransform3D, CMovement3D>().parallelEach(
+        jobs, [](size_t id, CTransform3D& transform, CMovement3D&) {
+            transform.position.x += static_cast<float>(id);
+        }, 128);
+    
+    size_t expected = count - (count + 2) / 3;
+    EXPECT_EQ(visited, expected);
+    for (size_t id = 0; id < count; ++id) {
+        float x = manager->getComponent<CTransform3D>(id).position.x;
+        ASSERT_FLOAT_EQ(x, id % 3 != 0 ? static_cast<float>(id) : 0.0f) << "entity " << id;
+    }
+}
@@ -2,6 +2,19 @@
 #include "../include/EntityManager.h"
 #include "../include/Component.h"
 
+namespace {
+struct RecordingListener : EntityListener {
+    std::vector<size_t> added;
+    std::vector<size_t> removed;
+    void onEntityAdded(Entity& entity) override { added.push_back(entity.id()); }
+    void onEntityRemoved(Entity& entity) override {
+        // Components are still attached when removal is reported
+        EXPECT_TRUE(entity.has<CTransform3D>());
+        removed.push_back(entity.id());
+    }
+};
+} // namespace
+
 class EntityManagerTest : public ::testing::Test {
 protected:
     void SetUp() override {
@@ -178,4 +191,135 @@ TEST_F(EntityManagerTest, ComplexLifecycle_MultipleUpdates) {
     EXPECT_EQ(manager.getEntities(EntityTag::ENEMY).size(), 1);
     EXPECT_EQ(manager.getEntities(EntityTag::PLAYER)[0], p2);
     EXPECT_EQ(manager.getEntities(EntityTag::ENEMY)[0], e1);
-}
\ No newline at end of file
+}
+// ============================================================================
+// Generational Handle Tests
+// ============================================================================
+
+TEST_F(EntityManagerTest, Handle_ResolvesToEntity) {
+    auto entity = manager.addEntity(EntityTag::PLAYER);
+    EntityHandle handle = entity->handle();
+    
+    EXPECT_FALSE(handle.isNull());
+    EXPECT_EQ(handle.index, entity->id());
+    EXPECT_TRUE(manager.isValid(handle));
+    EXPECT_EQ(manager.getEntity(handle), entity.get()); // Pending entities resolve
+    
+    manager.update();
+    EXPECT_EQ(manager.getEntity(handle), entity.get());
+}
+
+TEST_F(EntityManagerTest, Handle_BecomesStaleAfterDestroy) {
+    auto entity = manager.addEntity(EntityTag::ENEMY);
+    manager.update();
+    EntityHandle handle = entity->handle();
+    
+    entity->destroy();
+    EXPECT_TRUE(manager.isValid(handle)); // Still valid until update processes removal
+    
+    manager.update();
+    EXPECT_FALSE(manager.isValid(handle));
+    EXPECT_EQ(manager.getEntity(handle), nullptr);
+    EXPECT_EQ(manager.getEntityById(handle.index), nullptr);
+}
+
+TEST_F(EntityManagerTest, Handle_ReusedSlotGetsNewGeneration) {
+    auto first = manager.addEntity(EntityTag::ENEMY);
+    manager.update();
+    EntityHandle oldHandle = first->handle();
+    
+    first->destroy();
+    manager.update();
+    
+    auto second = manager.addEntity(EntityTag::ENEMY);
+    manager.update();
+    
+    // ID is recycled, generation is not
+    EXPECT_EQ(second->id(), first->id());
+    EXPECT_NE(second->handle(), oldHandle);
+    EXPECT_FALSE(manager.isValid(oldHandle));
+    EXPECT_EQ(manager.getEntity(second->handle()), second.get());
+}
+
+TEST_F(EntityManagerTest, Handle_StaleEntityDoesNotTouchReusedComponents) {
+    auto first = manager.addEntity(EntityTag::DEFAULT);
+    first->add<CTransform3D>(glm::vec3(1.0f), glm::vec3(0.0f), glm::vec3(1.0f));
+    manager.update();
+    
+    first->destroy();
+    manager.update();
+    EXPECT_FALSE(first->has<CTransform3D>());
+    
+    auto second = manager.addEntity(EntityTag::DEFAULT);
+    second->add<CTransform3D>(glm::vec3(2.0f), glm::vec3(0.0f), glm::vec3(1.0f));
+    manager.update();
+    ASSERT_EQ(second->id(), first->id());
+    
+    // Releasing the last reference to the stale entity must not strip the new one
+    first.reset();
+    ASSERT_TRUE(second->has<CTransform3D>());
+    EXPECT_EQ(second->get<CTransform3D>().position.x, 2.0f);
+}
+
+TEST_F(EntityManagerTest, GetHandles_MatchesEntityOrder) {
+    auto a = manager.addEntity(EntityTag::PLAYER);
+    auto b = manager.addEntity(EntityTag::ENEMY);
+    auto c = manager.addEntity(EntityTag::ENEMY);
+    manager.update();
+    
+    b->destroy();
+    manager.update();
+    
+    const auto& handles = manager.getHandles();
+    const auto& entities = manager.getEntities();
+    ASSERT_EQ(handles.size(), entities.size());
+    for (size_t i = 0; i < handles.size(); ++i) {
+        EXPECT_EQ(manager.getEntity(handles[i]), entities[i].get());
+    }
+}
+
+TEST_F(EntityManagerTest, Clear_InvalidatesOutstandingHandles) {
+    auto entity = manager.addEntity(EntityTag::DEFAULT);
+    manager.update();
+    EntityHandle handle = entity->handle();
+    
+    manager.clear();
+    auto replacement = manager.addEntity(EntityTag::DEFAULT);
+    
+    EXPECT_EQ(replacement->id(), handle.index);
+    EXPECT_FALSE(manager.isValid(handle));
+    EXPECT_TRUE(manager.isValid(replacement->handle()));
+}
+
+TEST_F(EntityManagerTest, Listener_ReceivesAddedAndRemovedFromUpdate) {
+    auto listener = std::make_shared<RecordingListener>();
+    manager.addListener(listener);
+    EXPECT_TRUE(manager.hasListener(listener.get()));
+    
+    auto a = manager.addEntity(EntityTag::DEFAULT);
+    auto b = manager.addEntity(EntityTag::DEFAULT);
+    a->add<CTransform3D>();
+    b->add<CTransform3D>();
+    EXPECT_TRUE(listener->added.empty()); // Deferred until update()
+    
+    manager.update();
+    EXPECT_EQ(listener->added, (std::vector<size_t>{a->id(), b->id()}));
+    
+    a->destroy();
+    manager.update();
+    EXPECT_EQ(listener->removed, (std::vector<size_t>{a->id()}));
+    
+    manager.clear();
+    EXPECT_EQ(listener->removed, (std::vector<size_t>{a->id(), b->id()}));
+}
+
+TEST_F(EntityManagerTest, Listener_ExpiredListenerIsDropped) {
+    auto listener = std::make_shared<RecordingListener>();
+    const EntityListener* raw = listener.get();
+    manager.addListener(listener);
+    listener.reset();
+    
+    manager.addEntity(EntityTag::DEFAULT);
+    manager.update(); // Must not call into the dead listener
+    EXPECT_FALSE(manager.hasListener(raw));
+}
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+#include "../include/FixedTimestep.hpp"
+#include "../include/TransformInterpolator.hpp"
+#include "../include/EntityManager.h"
+#include <glm/glm.hpp>
+
+/**
+ * Unit tests for the fixed-timestep accumulator and render interpolation
+ *
+ * Frame time must turn into whole ticks with the remainder carried over,
+ * the substep cap must drop backlog instead of bursting, and interpolated
+ * transforms must blend between the pre-tick snapshot and the current
+ * state (falling back to the current state for unsnapshotted entities).
+ */
+
+TEST(FixedTimestepTest, AccumulatesFrameTimeIntoWholeTicks) {
+    FixedTimestep timestep(100.0f, 8); // 10 ms ticks
+    EXPECT_FLOAT_EQ(timestep.getStep(), 0.01f);
+
+    EXPECT_EQ(timestep.advance(0.004f), 0);
+    EXPECT_NEAR(timestep.getAlpha(), 0.4f, 1e-4f);
+    EXPECT_EQ(timestep.advance(0.008f), 1); // 12 ms accumulated
+    EXPECT_NEAR(timestep.getAlpha(), 0.2f, 1e-4f);
+
+    // 60 Hz rendering over one second of a 100 Hz simulation runs ~100 ticks
+    int ticks = 0;
+    for (int frame = 0; frame < 60; ++frame) {
+        ticks += timestep.advance(1.0f / 60.0f);
+    }
+    EXPECT_NEAR(ticks, 100, 1);
+    EXPECT_GE(timestep.getAlpha(), 0.0f);
+    EXPECT_LT(timestep.getAlpha(), 1.0f);
+    EXPECT_EQ(timestep.getDroppedSeconds(), 0.0);
+}
+
+TEST(FixedTimestepTest, SubstepCapDropsBacklog) {
+    FixedTimestep timestep(100.0f, 4);
+
+    // A 1 s hitch runs only 4 ticks and keeps less than one tick of remainder
+    EXPECT_EQ(timestep.advance(1.0f), 4);
+    EXPECT_LT(timestep.getAlpha(), 1.0f);
+    EXPECT_NEAR(timestep.getDroppedSeconds(), 0.96, 0.011);
+    EXPECT_EQ(timestep.advance(0.0f), 0);
+
+    // Reset discards the remainder (used while paused)
+    timestep.advance(0.005f);
+    timestep.reset();
+    EXPECT_EQ(timestep.getAlpha(), 0.0f);
+
+    // Rate changes apply to the next advance
+    timestep.setTickRate(50.0f);
+    EXPECT_EQ(timestep.advance(0.03f), 1);
+    EXPECT_EQ(timestep.getTotalTicks(), 5);
+}
+
+TEST(FixedTimestepTest, InterpolatorBlendsFromPreTickSnapshot) {
+    EntityManager entityManager;
+    auto moving = entityManager.addEntity(EntityTag::TRIANGLE);
+    moving->add<CTransform3D>(glm::vec3(0.0f), glm::vec3(0.0f), glm::vec3(1.0f));
+    entityManager.update();
+
+    TransformInterpolator interpolator;
+    interpolator.capture(entityManager);
+
+    // Simulated tick moves the entity after the snapshot
+    moving->get<CTransform3D>().position = glm::vec3(10.0f, 0.0f, 0.0f);
+    moving->get<CTransform3D>().rotation = glm::vec3(0.0f, 90.0f, 0.0f);
+
+    // Spawned after the capture: no snapshot, renders where it is
+    auto spawned = entityManager.addEntity(EntityTag::TRIANGLE);
+    spawned->add<CTransform3D>(glm::vec3(5.0f), glm::vec3(0.0f), glm::vec3(1.0f));
+    entityManager.update();
+    const auto& transform = moving->get<CTransform3D>(); // After the spawn grew the array
+
+    interpolator.setAlpha(0.25f);
+    EXPECT_EQ(interpolator.position(moving->id(), transform), glm::vec3(2.5f, 0.0f, 0.0f));
+    EXPECT_EQ(interpolator.rotation(moving->id(), transform), glm::vec3(0.0f, 22.5f, 0.0f));
+    EXPECT_EQ(interpolator.position(spawned->id(), spawned->get<CTransform3D>()), glm::vec3(5.0f));
+
+    interpolator.setAlpha(1.0f);
+    EXPECT_EQ(interpolator.position(moving->id(), transform), transform.position);
+
+    interpolator.setAlpha(0.0f);
+    interpolator.clear();
+    EXPECT_EQ(interpolator.position(moving->id(), transform), transform.position);
+}
+
+TEST(FixedTimestepTest, InterpolatorDropsSnapshotOfRemovedEntity) {
+    EntityManager entityManager;
+    auto removed = entityManager.addEntity(EntityTag::TRIANGLE);
+    removed->add<CTransform3D>(glm::vec3(100.0f), glm::vec3(0.0f), glm::vec3(1.0f));
+    entityManager.update();
+
+    TransformInterpolator interpolator;
+    interpolator.capture(entityManager);
+    interpolator.setAlpha(0.5f);
+
+    // Zero-tick frame: the entity dies and a new one takes its slot before the next capture
+    const size_t oldID = removed->id();
+    removed->destroy();
+    entityManager.update();
+    auto reused = entityManager.addEntity(EntityTag::TRIANGLE);
+    ASSERT_EQ(reused->id(), oldID);
+    reused->add<CTransform3D>(glm::vec3(0.0f), glm::vec3(0.0f), glm::vec3(1.0f));
+    entityManager.update();
+
+    const auto& transform = reused->get<CTransform3D>();
+    EXPECT_EQ(interpolator.position(reused->id(), transform), glm::vec3(0.0f));
+    EXPECT_TRUE(interpolator.rendersCurrent(reused->id(), transform));
+}
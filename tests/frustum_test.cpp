@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include "../include/Frustum.hpp"
+#include "../include/Camera.h"
+#include "../include/Constants.hpp"
+#include "../include/SpatialPartition.hpp"
+#include <algorithm>
+#include <memory>
+
+/**
+ * Unit tests for view-frustum plane extraction and culling queries
+ *
+ * Planes come from projection * view of a camera at (0, 0, 3) looking
+ * down -z. Points, spheres and boxes must be classified against the six
+ * planes, and bounds() must be a box the partition can be queried with
+ * so that off-screen cells are never visited.
+ */
+class FrustumTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        camera = std::make_shared<Camera>(glm::vec3(0.0f, 0.0f, 3.0f));
+        frustum = std::make_unique<Frustum>(camera->getProjectionMatrix(1.0f) *
+                                            camera->getViewMatrix());
+    }
+
+    std::shared_ptr<Camera> camera;
+    std::unique_ptr<Frustum> frustum;
+};
+
+TEST_F(FrustumTest, ClassifiesPointsAgainstAllPlanes) {
+    EXPECT_TRUE(frustum->containsPoint(glm::vec3(0.0f, 0.0f, 0.0f)));
+    EXPECT_TRUE(frustum->containsPoint(glm::vec3(0.0f, 0.0f, -50.0f)));
+
+    EXPECT_FALSE(frustum->containsPoint(glm::vec3(0.0f, 0.0f, 5.0f)));   // Behind the camera
+    EXPECT_FALSE(frustum->containsPoint(glm::vec3(0.0f, 0.0f, 2.95f)));  // Before the near plane
+    EXPECT_FALSE(frustum->containsPoint(glm::vec3(0.0f, 0.0f, -200.0f))); // Past the far plane
+    EXPECT_FALSE(frustum->containsPoint(glm::vec3(10.0f, 0.0f, 0.0f)));  // Left/right of a 45 degree fov
+    EXPECT_FALSE(frustum->containsPoint(glm::vec3(0.0f, -10.0f, 0.0f)));
+
+    // Normalized planes: the near plane sits NEAR_CLIP_PLANE in front of the eye
+    const glm::vec4& nearPlane = frustum->plane(Frustum::NEAR_PLANE);
+    EXPECT_NEAR(nearPlane.z, -1.0f, 1e-4f);
+    EXPECT_NEAR(nearPlane.z * 3.0f + nearPlane.w, -0.1f, 1e-3f);
+}
+
+TEST_F(FrustumTest, SpheresAndBoxesStraddlingAPlaneAreKept) {
+    // Center outside the right plane, but the radius reaches back in
+    const glm::vec3 center(3.0f, 0.0f, 0.0f);
+    EXPECT_FALSE(frustum->intersectsSphere(center, 0.5f));
+    EXPECT_TRUE(frustum->intersectsSphere(center, 2.0f));
+
+    EXPECT_TRUE(frustum->intersectsAABB(CAABB(center, glm::vec3(2.0f))));
+    EXPECT_FALSE(frustum->intersectsAABB(CAABB(center, glm::vec3(0.5f))));
+    EXPECT_FALSE(frustum->intersectsAABB(CAABB(glm::vec3(0.0f, 0.0f, 10.0f), glm::vec3(1.0f))));
+}
+
+TEST_F(FrustumTest, BoundsEncloseTheViewVolume) {
+    CAABB bounds = frustum->bounds();
+
+    // Apex side ends at the near plane, the far side at the far plane
+    EXPECT_NEAR(bounds.max.z, 3.0f - EngineConstants::Camera::NEAR_CLIP_PLANE, 1e-3f);
+    EXPECT_NEAR(bounds.min.z, 3.0f - EngineConstants::Camera::FAR_CLIP_PLANE, 1e-2f);
+    EXPECT_LT(bounds.min.x, -1.0f);
+    EXPECT_GT(bounds.max.x, 1.0f);
+
+    for (glm::vec3 point : {glm::vec3(0.0f), glm::vec3(1.0f, 1.0f, -20.0f), glm::vec3(0.0f, 0.0f, -90.0f)}) {
+        ASSERT_TRUE(frustum->containsPoint(point));
+        for (int axis = 0; axis < 3; ++axis) {
+            EXPECT_GE(point[axis], bounds.min[axis]);
+            EXPECT_LE(point[axis], bounds.max[axis]);
+        }
+    }
+}
+
+TEST_F(FrustumTest, PartitionQuerySkipsCellsBehindTheCamera) {
+    // The frustum's box starts at the near plane, so cells behind the camera are skipped
+    auto partition = createSpatialPartition(PartitionType::UNIFORM_GRID, glm::vec3(-10.0f),
+                                            glm::vec3(10.0f), 2.0f);
+
+    EntityID visible = 1, behind = 2;
+    partition->insert(visible, CAABB(glm::vec3(0.0f, 0.0f, -5.0f), glm::vec3(0.5f)));
+    partition->insert(behind, CAABB(glm::vec3(0.0f, 0.0f, 9.0f), glm::vec3(0.5f)));
+
+    std::vector<EntityID> candidates;
+    partition->query(frustum->bounds(), candidates);
+    EXPECT_NE(std::find(candidates.begin(), candidates.end(), visible), candidates.end());
+    EXPECT_EQ(std::find(candidates.begin(), candidates.end(), behind), candidates.end());
+}
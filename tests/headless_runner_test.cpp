@@ -0,0 +1,39 @@
+#include <gtest/gtest.h>
+#include "../include/HeadlessRunner.hpp"
+#include <sstream>
+
+/**
+ * Tests for the windowless simulation runner
+ *
+ * A headless GameScene must spawn the requested entity count, run every
+ * physics system each tick, and push every tick through the NullRenderer.
+ */
+
+TEST(HeadlessRunnerTest, RunsRequestedTicksWithoutWindow) {
+    HeadlessRunner::Options options;
+    options.entities = 30; // Not a perfect cube: the spawn grid stops part way
+    options.ticks = 10;
+    options.threads = 2;
+
+    HeadlessRunner::Report report = HeadlessRunner::run(options);
+
+    EXPECT_EQ(report.ticks, 10u);
+    EXPECT_EQ(report.entities, 30u);
+    EXPECT_EQ(report.threads, 2u);
+    EXPECT_EQ(report.framesRendered, 10u);
+    EXPECT_GT(report.ticksPerSecond, 0.0);
+
+    ASSERT_EQ(report.systems.size(), 4u);
+    double shares = 0.0;
+    for (const auto& system : report.systems) {
+        EXPECT_FALSE(system.name.empty());
+        EXPECT_GE(system.averageMs, 0.0);
+        shares += system.share;
+    }
+    EXPECT_NEAR(shares, 1.0, 1e-9);
+
+    std::ostringstream out;
+    HeadlessRunner::printReport(report, out);
+    EXPECT_NE(out.str().find("ticks/s"), std::string::npos);
+    EXPECT_NE(out.str().find(report.systems[0].name), std::string::npos);
+}
@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+#include "../include/JobSystem.hpp"
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <vector>
+
+/**
+ * Unit tests for the work-stealing JobSystem
+ *
+ * Every index must run exactly once per parallelFor, thread indices must
+ * stay in range and never be shared by concurrent jobs, back-to-back
+ * batches must not leak into each other, nested loops must complete, and
+ * dependent submits must wait for the counter they depend on.
+ */
+
+TEST(JobSystemTest, ParallelForRunsEveryJobOnce) {
+    JobSystem jobs(3);
+    EXPECT_EQ(jobs.getWorkerCount(), 3u);
+    EXPECT_EQ(jobs.getThreadCount(), 4u);
+
+    for (size_t jobCount : {0u, 1u, 7u, 1000u}) {
+        std::vector<std::atomic<int>> runs(jobCount);
+        std::vector<std::atomic<int>> busy(jobs.getThreadCount());
+        std::atomic<bool> threadInRange{true};
+        std::atomic<bool> threadShared{false};
+
+        jobs.parallelFor(jobCount, [&](size_t job, size_t thread) {
+            if (thread >= busy.size()) {
+                threadInRange = false;
+                return;
+            }
+            if (busy[thread].fetch_add(1) != 0) {
+                threadShared = true;
+            }
+            runs[job]++;
+            busy[thread]--;
+        });
+
+        EXPECT_TRUE(threadInRange);
+        EXPECT_FALSE(threadShared);
+        for (size_t job = 0; job < jobCount; ++job) {
+            ASSERT_EQ(runs[job].load(), 1) << "job " << job << " of " << jobCount;
+        }
+    }
+}
+
+TEST(JobSystemTest, BackToBackBatchesStayIsolated) {
+    JobSystem jobs(2);
+    std::vector<int> results(64);
+    for (int batch = 0; batch < 200; ++batch) {
+        jobs.parallelFor(results.size(), [&](size_t job, size_t) {
+            results[job] = batch;
+        });
+        for (int value : results) {
+            ASSERT_EQ(value, batch);
+        }
+    }
+}
+
+TEST(JobSystemTest, ZeroWorkersRunsInline) {
+    JobSystem jobs(0);
+    EXPECT_EQ(jobs.getThreadCount(), 1u);
+
+    size_t sum = 0;
+    jobs.parallelFor(10, [&](size_t job, size_t thread) {
+        EXPECT_EQ(thread, 0u);
+        sum += job;
+    });
+    EXPECT_EQ(sum, 45u);
+}
+
+TEST(JobSystemTest, ParallelForRangeCoversRangeInGrains) {
+    JobSystem jobs(3);
+    std::vector<int> hits(10000, 0);
+    std::atomic<size_t> largestChunk{0};
+
+    jobs.parallelForRange(hits.size(), 64, [&](size_t begin, size_t end, size_t) {
+        size_t size = end - begin;
+        size_t seen = largestChunk.load();
+        while (size > seen && !largestChunk.compare_exchange_weak(seen, size)) {
+        }
+        for (size_t i = begin; i < end; ++i) {
+            hits[i]++;
+        }
+    });
+
+    EXPECT_LE(largestChunk.load(), 64u);
+    EXPECT_EQ(std::accumulate(hits.begin(), hits.end(), 0), 10000);
+    EXPECT_EQ(*std::max_element(hits.begin(), hits.end()), 1);
+}
+
+TEST(JobSystemTest, NestedParallelForCompletes) {
+    JobSystem jobs(3);
+    std::vector<std::atomic<int>> cells(32 * 32);
+
+    jobs.parallelFor(32, [&](size_t row, size_t) {
+        jobs.parallelFor(32, [&](size_t column, size_t thread) {
+            EXPECT_EQ(thread, jobs.getCurrentThreadIndex());
+            cells[row * 32 + column]++;
+        });
+    });
+
+    for (const auto& cell : cells) {
+        ASSERT_EQ(cell.load(), 1);
+    }
+}
+
+TEST(JobSystemTest, SubmitRunsDependentsAfterTheirCounter) {
+    JobSystem jobs(2);
+    JobCounter first;
+    JobCounter second;
+    std::atomic<int> firstDone{0};
+    std::atomic<bool> orderViolated{false};
+
+    for (int i = 0; i < 8; ++i) {
+        jobs.submit(first, [&]() { firstDone++; });
+    }
+    for (int i = 0; i < 4; ++i) {
+        jobs.submit(second, [&]() {
+            if (firstDone.load() != 8) {
+                orderViolated = true;
+            }
+        }, &first);
+    }
+
+    jobs.wait(second);
+    EXPECT_TRUE(first.isDone());
+    EXPECT_TRUE(second.isDone());
+    EXPECT_EQ(firstDone.load(), 8);
+    EXPECT_FALSE(orderViolated);
+
+    // A dependency that is already done does not hold the job back
+    jobs.submit(second, [&]() { firstDone++; }, &first);
+    jobs.wait(second);
+    EXPECT_EQ(firstDone.load(), 9);
+}
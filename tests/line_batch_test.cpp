@@ -0,0 +1,44 @@
+#include <gtest/gtest.h>
+#include "../include/LineBatch.hpp"
+
+/**
+ * Unit tests for the debug line batch
+ *
+ * Lines must land in the renderer's interleaved position + color layout,
+ * and only a change of width may start a new run (draw call).
+ */
+
+TEST(LineBatchTest, InterleavesPositionAndColorPerVertex) {
+    LineBatch lines;
+    lines.addLine(glm::vec3(1.0f, 2.0f, 3.0f), glm::vec3(4.0f, 5.0f, 6.0f), glm::vec3(0.1f, 0.2f, 0.3f));
+
+    ASSERT_EQ(lines.lineCount(), 1u);
+    ASSERT_EQ(lines.vertexCount(), 2u);
+    const std::vector<float> expected = {1.0f, 2.0f, 3.0f, 0.1f, 0.2f, 0.3f,
+                                         4.0f, 5.0f, 6.0f, 0.1f, 0.2f, 0.3f};
+    EXPECT_EQ(lines.vertices(), expected);
+}
+
+TEST(LineBatchTest, MergesConsecutiveLinesOfEqualWidthIntoRuns) {
+    LineBatch lines;
+    for (int i = 0; i < 10; ++i) {
+        lines.addLine(glm::vec3(i, 0, -1), glm::vec3(i, 0, 1), glm::vec3(0.4f), 2.0f);
+    }
+    lines.addLine(glm::vec3(-1, 0, 0), glm::vec3(1, 0, 0), glm::vec3(1, 0, 0), 5.0f);
+    lines.addLine(glm::vec3(0, 0, -1), glm::vec3(0, 0, 1), glm::vec3(0, 0, 1), 5.0f);
+    lines.addLine(glm::vec3(0, 0, 0), glm::vec3(0, 1, 0), glm::vec3(0.4f), 2.0f);
+
+    ASSERT_EQ(lines.runs().size(), 3u);
+    EXPECT_EQ(lines.runs()[0].width, 2.0f);
+    EXPECT_EQ(lines.runs()[0].firstVertex, 0u);
+    EXPECT_EQ(lines.runs()[0].vertexCount, 20u);
+    EXPECT_EQ(lines.runs()[1].width, 5.0f);
+    EXPECT_EQ(lines.runs()[1].firstVertex, 20u);
+    EXPECT_EQ(lines.runs()[1].vertexCount, 4u);
+    EXPECT_EQ(lines.runs()[2].firstVertex, 24u);
+    EXPECT_EQ(lines.lineCount(), 13u);
+
+    lines.clear();
+    EXPECT_TRUE(lines.empty());
+    EXPECT_TRUE(lines.runs().empty());
+}
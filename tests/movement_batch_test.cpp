@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+#include "../include/MovementBatch.hpp"
+#include <random>
+
+/**
+ * Unit tests for the batched SoA movement integrator
+ *
+ * The compiled kernel (AVX2/SSE2/scalar, see MovementBatch::kernelName())
+ * must match the scalar reference for every lane, including the scalar
+ * tail, movers without a limit and movers exactly at their limit.
+ */
+
+TEST(MovementBatchTest, KernelMatchesScalarReference) {
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> value(-20.0f, 20.0f);
+    std::uniform_real_distribution<float> limit(0.5f, 25.0f);
+
+    // Not a multiple of 8 so the SIMD loop leaves a tail
+    MovementBatch simd;
+    MovementBatch reference;
+    for (int i = 0; i < 8 * 16 + 5; ++i) {
+        glm::vec3 position(value(rng), value(rng), value(rng));
+        glm::vec3 velocity(value(rng), value(rng), value(rng));
+        glm::vec3 acceleration(value(rng), value(rng), value(rng));
+        float maxSpeed = (i % 3 == 0) ? MovementBatch::NO_SPEED_LIMIT : limit(rng);
+        simd.push_back(position, velocity, acceleration, maxSpeed);
+        reference.push_back(position, velocity, acceleration, maxSpeed);
+    }
+    // Zero speed against a zero limit must not divide its way to NaN
+    simd.push_back(glm::vec3(0.0f), glm::vec3(0.0f), glm::vec3(0.0f), 0.0f);
+    reference.push_back(glm::vec3(0.0f), glm::vec3(0.0f), glm::vec3(0.0f), 0.0f);
+
+    for (bool limitSpeed : {false, true}) {
+        for (int step = 0; step < 3; ++step) {
+            simd.integrate(0.1f, limitSpeed);
+            reference.integrateScalar(0.1f, limitSpeed);
+        }
+    }
+
+    ASSERT_EQ(simd.size(), reference.size());
+    for (size_t i = 0; i < simd.size(); ++i) {
+        for (int axis = 0; axis < 3; ++axis) {
+            ASSERT_FLOAT_EQ(simd.velocity(i)[axis], reference.velocity(i)[axis])
+                << MovementBatch::kernelName() << " mover " << i;
+            ASSERT_FLOAT_EQ(simd.position(i)[axis], reference.position(i)[axis])
+                << MovementBatch::kernelName() << " mover " << i;
+        }
+    }
+    EXPECT_EQ(simd.velocity(simd.size() - 1), glm::vec3(0.0f));
+}
+
+TEST(MovementBatchTest, SpeedLimitClampsOnlyFasterMovers) {
+    MovementBatch batch;
+    batch.push_back(glm::vec3(0.0f), glm::vec3(3.0f, 4.0f, 0.0f), glm::vec3(0.0f), 2.5f);  // Clamped
+    batch.push_back(glm::vec3(0.0f), glm::vec3(3.0f, 4.0f, 0.0f), glm::vec3(0.0f), 5.0f);  // At limit
+    batch.push_back(glm::vec3(0.0f), glm::vec3(0.0f), glm::vec3(0.0f), 1.0f);              // At rest
+    for (int i = 0; i < 6; ++i) {
+        batch.push_back(glm::vec3(0.0f), glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(1.0f, 0.0f, 0.0f));
+    }
+
+    batch.integrate(1.0f, true);
+
+    EXPECT_FLOAT_EQ(batch.velocity(0).x, 1.5f);
+    EXPECT_FLOAT_EQ(batch.velocity(0).y, 2.0f);
+    EXPECT_FLOAT_EQ(batch.position(0).y, 2.0f);
+    EXPECT_FLOAT_EQ(batch.velocity(1).y, 4.0f);
+    EXPECT_EQ(batch.velocity(2), glm::vec3(0.0f));
+    for (size_t i = 3; i < batch.size(); ++i) {
+        EXPECT_EQ(batch.velocity(i), glm::vec3(2.0f, 0.0f, 0.0f));
+        EXPECT_EQ(batch.position(i), glm::vec3(2.0f, 0.0f, 0.0f));
+    }
+
+    batch.clear();
+    EXPECT_TRUE(batch.empty());
+}
@@ -158,4 +158,33 @@ TEST_F(OpenGLRendererTest, Transform3D_ModificationWorks) {
     EXPECT_EQ(transform.position, pos);
     EXPECT_EQ(transform.rotation, rot);
     EXPECT_EQ(transform.scale, scale);
-}
\ No newline at end of file
+}
+// The instanced path's closed-form model matrix must match the glm chain
+// the per-entity path used (translate, rotate X/Y/Z in degrees, scale)
+TEST_F(OpenGLRendererTest, ModelMatrix_MatchesTranslateRotateScaleChain) {
+    const glm::vec3 positions[] = {glm::vec3(0.0f), glm::vec3(1.0f, -2.0f, 3.5f)};
+    const glm::vec3 rotations[] = {glm::vec3(0.0f), glm::vec3(30.0f, 0.0f, 0.0f),
+                                   glm::vec3(0.0f, 45.0f, 0.0f), glm::vec3(0.0f, 0.0f, 60.0f),
+                                   glm::vec3(45.0f, 90.0f, 180.0f), glm::vec3(-12.0f, 271.0f, 33.0f)};
+    const glm::vec3 scales[] = {glm::vec3(1.0f), glm::vec3(2.0f, 0.5f, 3.0f)};
+
+    for (const auto& position : positions) {
+        for (const auto& rotation : rotations) {
+            for (const auto& scale : scales) {
+                glm::mat4 expected = glm::translate(glm::mat4(1.0f), position);
+                expected = glm::rotate(expected, glm::radians(rotation.x), glm::vec3(1.0f, 0.0f, 0.0f));
+                expected = glm::rotate(expected, glm::radians(rotation.y), glm::vec3(0.0f, 1.0f, 0.0f));
+                expected = glm::rotate(expected, glm::radians(rotation.z), glm::vec3(0.0f, 0.0f, 1.0f));
+                expected = glm::scale(expected, scale);
+
+                glm::mat4 model = TransformSystem::modelMatrix(position, rotation, scale);
+                for (int column = 0; column < 4; ++column) {
+                    for (int row = 0; row < 4; ++row) {
+                        EXPECT_NEAR(model[column][row], expected[column][row], 1e-5f)
+                            << "column " << column << " row " << row;
+                    }
+                }
+            }
+        }
+    }
+}
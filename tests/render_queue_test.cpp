@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+#include "../include/RenderQueue.hpp"
+#include <algorithm>
+#include <random>
+
+/**
+ * Unit tests for the render queue's sort keys and radix sort
+ *
+ * Keys must order by layer, shader, mesh, then depth; the sort must
+ * match a stable sort on the key and skip digits that never vary.
+ */
+
+TEST(RenderQueueTest, KeyFieldsRoundTripAndOrderMostSignificantFirst) {
+    uint64_t key = RenderQueue::makeKey(3, 0x123, 0xBEEF, 42);
+    EXPECT_EQ(RenderQueue::layerOf(key), 3u);
+    EXPECT_EQ(RenderQueue::shaderOf(key), 0x123u);
+    EXPECT_EQ(RenderQueue::meshOf(key), 0xBEEFu);
+    EXPECT_EQ(key & 0xFFFFFFFFu, 42u);
+
+    // Layer outranks shader, shader outranks mesh, mesh outranks depth
+    EXPECT_LT(RenderQueue::makeKey(0, 9, 9, ~0u), RenderQueue::makeKey(1, 0, 0, 0));
+    EXPECT_LT(RenderQueue::makeKey(0, 0, 9, ~0u), RenderQueue::makeKey(0, 1, 0, 0));
+    EXPECT_LT(RenderQueue::makeKey(0, 0, 0, ~0u), RenderQueue::makeKey(0, 0, 1, 0));
+
+    const float depths[] = {-100.0f, -1.5f, -0.0f, 0.0f, 0.25f, 1.0f, 3.0f, 1e6f};
+    for (size_t i = 1; i < sizeof(depths) / sizeof(depths[0]); ++i) {
+        EXPECT_LE(RenderQueue::depthBits(depths[i - 1]), RenderQueue::depthBits(depths[i]))
+            << depths[i - 1] << " vs " << depths[i];
+    }
+}
+
+TEST(RenderQueueTest, RadixSortMatchesStableSortAndSkipsConstantDigits) {
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> depth(-50.0f, 50.0f);
+    std::uniform_int_distribution<uint32_t> shader(0, 3);
+
+    RenderQueue queue;
+    for (uint32_t i = 0; i < 5000; ++i) {
+        // Few distinct depths so equal keys exist and stability is observable
+        float d = static_cast<float>(static_cast<int>(depth(rng)));
+        queue.submit(RenderQueue::makeKey(0, shader(rng), i % 2, RenderQueue::depthBits(d)), i);
+    }
+    std::vector<RenderCommand> expected = queue.commands();
+    std::stable_sort(expected.begin(), expected.end(),
+                     [](const RenderCommand& a, const RenderCommand& b) { return a.key < b.key; });
+
+    queue.sort();
+    ASSERT_EQ(queue.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_EQ(queue.commands()[i].key, expected[i].key) << i;
+        ASSERT_EQ(queue.commands()[i].index, expected[i].index) << i;
+    }
+    // Depth varies in its top bytes; layer/shader/mesh fit in the top 32 bits
+    EXPECT_LT(queue.getLastSortPasses(), 8);
+
+    // One state for the whole frame: only the depth digits need passes
+    queue.clear();
+    for (uint32_t i = 0; i < 1000; ++i) {
+        queue.submit(RenderQueue::makeKey(0, 1, 0, 1000 - i), i);
+    }
+    queue.sort();
+    EXPECT_LE(queue.getLastSortPasses(), 2);
+    EXPECT_EQ(queue.commands().front().index, 999u);
+    EXPECT_EQ(queue.commands().back().index, 0u);
+}
@@ -0,0 +1,24 @@
+#include <gtest/gtest.h>
+#include "../include/ShaderProgram.hpp"
+#include <stdexcept>
+
+/**
+ * Tests for shader lookup by name
+ *
+ * Compiling needs a GL context, so these cover the context-free parts:
+ * unknown names and unreadable sources must not register a program.
+ */
+
+TEST(ShaderRegistryTest, UnknownNameReturnsNull) {
+    ShaderRegistry registry;
+    EXPECT_EQ(registry.get("color"), nullptr);
+    EXPECT_EQ(registry.size(), 0u);
+}
+
+TEST(ShaderRegistryTest, MissingSourceThrowsWithoutRegistering) {
+    ShaderRegistry registry;
+    EXPECT_THROW(registry.load("missing", "./src/NoSuchShader.vert", "./src/DepthFragment.frag"),
+                 std::runtime_error);
+    EXPECT_EQ(registry.get("missing"), nullptr);
+    EXPECT_EQ(registry.size(), 0u);
+}
@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+#include "../include/ShapeBatch.hpp"
+#include "../include/Component.h"
+#include <cmath>
+#include <vector>
+
+/**
+ * Unit tests for batched 2D shape triangulation
+ *
+ * Polygons must triangulate like sf::Shape (fan fill around the bounds
+ * center, mitred outline band), CComplexShape must keep its triangles
+ * until the geometry changes, and the batch must append everything into
+ * one triangle list in submission order.
+ */
+
+namespace {
+const std::vector<Vec2f> SQUARE = {Vec2f(0.0f, 0.0f), Vec2f(10.0f, 0.0f), Vec2f(10.0f, 10.0f),
+                                   Vec2f(0.0f, 10.0f)};
+
+bool containsPoint(const std::vector<Vec2f>& points, const Vec2f& expected) {
+    for (const auto& point : points) {
+        if (std::abs(point.x - expected.x) < 1e-4f && std::abs(point.y - expected.y) < 1e-4f) {
+            return true;
+        }
+    }
+    return false;
+}
+} // namespace
+
+TEST(ShapeBatchTest, TriangulatesFillFanAndMitredOutline) {
+    std::vector<Vec2f> fill, outline;
+    ShapeBatch::triangulate(SQUARE, 1.0f, fill, outline);
+
+    ASSERT_EQ(fill.size(), 4u * ShapeBatch::VERTICES_PER_TRIANGLE);
+    for (size_t i = 0; i < fill.size(); i += ShapeBatch::VERTICES_PER_TRIANGLE) {
+        EXPECT_EQ(fill[i], Vec2f(5.0f, 5.0f)); // Every fan triangle starts at the center
+    }
+
+    // Two triangles per edge; corners pushed out diagonally by the thickness
+    ASSERT_EQ(outline.size(), 4u * 2 * ShapeBatch::VERTICES_PER_TRIANGLE);
+    EXPECT_TRUE(containsPoint(outline, Vec2f(-1.0f, -1.0f)));
+    EXPECT_TRUE(containsPoint(outline, Vec2f(11.0f, -1.0f)));
+    EXPECT_TRUE(containsPoint(outline, Vec2f(11.0f, 11.0f)));
+    EXPECT_TRUE(containsPoint(outline, Vec2f(-1.0f, 11.0f)));
+
+    // No outline without thickness, nothing for degenerate polygons
+    ShapeBatch::triangulate(SQUARE, 0.0f, fill, outline);
+    EXPECT_EQ(fill.size(), 12u);
+    EXPECT_TRUE(outline.empty());
+    ShapeBatch::triangulate({Vec2f(0.0f, 0.0f), Vec2f(1.0f, 0.0f)}, 1.0f, fill, outline);
+    EXPECT_TRUE(fill.empty());
+    EXPECT_TRUE(outline.empty());
+}
+
+TEST(ShapeBatchTest, ComplexShapeRetriangulatesOnlyWhenGeometryChanges) {
+    CComplexShape shape(SQUARE, sf::Color::White, sf::Color::Black, 2.0f);
+    EXPECT_TRUE(shape.updateTriangulation());
+    EXPECT_FALSE(shape.updateTriangulation());
+
+    // Pulsing colors reuse the cached triangles
+    shape.fillColor = sf::Color::Red;
+    EXPECT_FALSE(shape.updateTriangulation());
+
+    shape.outlineThickness = 4.0f; // Selection outline
+    EXPECT_TRUE(shape.updateTriangulation());
+    EXPECT_TRUE(containsPoint(shape.outlineTriangles, Vec2f(-4.0f, -4.0f)));
+
+    shape.vertices.pop_back();
+    EXPECT_TRUE(shape.updateTriangulation());
+    EXPECT_EQ(shape.fillTriangles.size(), 3u * ShapeBatch::VERTICES_PER_TRIANGLE);
+}
+
+TEST(ShapeBatchTest, AppendsShapesIntoOneTriangleList) {
+    std::vector<Vec2f> fill, outline;
+    ShapeBatch::triangulate(SQUARE, 1.0f, fill, outline);
+
+    ShapeBatch batch;
+    EXPECT_TRUE(batch.empty());
+    batch.append(fill, sf::Color::Green);
+    batch.append(outline, sf::Color::Black);
+
+    sf::Transform offset;
+    offset.translate(100.0f, 0.0f);
+    batch.append(fill, sf::Color::Blue, offset);
+
+    EXPECT_EQ(batch.vertices().getPrimitiveType(), sf::Triangles);
+    EXPECT_EQ(batch.triangleCount(), 4u + 8u + 4u);
+
+    // Submission order is draw order: first fill, its outline, then the moved copy
+    const sf::VertexArray& vertices = batch.vertices();
+    EXPECT_EQ(vertices[0].color, sf::Color::Green);
+    EXPECT_EQ(vertices[fill.size()].color, sf::Color::Black);
+    const sf::Vertex& moved = vertices[fill.size() + outline.size()];
+    EXPECT_EQ(moved.color, sf::Color::Blue);
+    EXPECT_FLOAT_EQ(moved.position.x, 105.0f);
+    EXPECT_FLOAT_EQ(moved.position.y, 5.0f);
+
+    batch.clear();
+    EXPECT_TRUE(batch.empty());
+}
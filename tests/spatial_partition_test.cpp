@@ -1,8 +1,11 @@
 #include <gtest/gtest.h>
 #include "../include/SpatialPartition.hpp"
+#include "../include/JobSystem.hpp"
+#include "AllocationCounter.hpp"
 #include <memory>
 #include <set>
 #include <algorithm>
+#include <random>
 
 /**
  * Unit tests for SpatialPartition strategies and algorithms
@@ -43,6 +46,50 @@ protected:
         return aabb;
     }
 
+    // Normalized pair set, failing on duplicates
+    static std::set<CollisionPair> toPairSet(const std::vector<CollisionPair>& pairs) {
+        std::set<CollisionPair> result;
+        for (auto [id1, id2] : pairs) {
+            EXPECT_TRUE(result.emplace(std::min(id1, id2), std::max(id1, id2)).second)
+                << "Duplicate collision pair found";
+        }
+        return result;
+    }
+    
+    // All-pairs reference result
+    static std::set<CollisionPair> bruteForcePairs(const std::vector<CAABB>& bounds) {
+        std::set<CollisionPair> result;
+        for (size_t i = 0; i < bounds.size(); ++i) {
+            for (size_t j = i + 1; j < bounds.size(); ++j) {
+                if (AABBUtils::intersects(bounds[i], bounds[j])) {
+                    result.emplace(i, j);
+                }
+            }
+        }
+        return result;
+    }
+    
+    // Clustered boxes of mixed sizes, some outside the world bounds
+    std::vector<CAABB> createClusteredBounds(size_t count, unsigned seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> clusterCenter(-12.0f, 12.0f);
+        std::normal_distribution<float> spread(0.0f, 1.5f);
+        std::uniform_real_distribution<float> size(0.05f, 1.0f);
+        
+        std::vector<glm::vec3> clusters;
+        for (int c = 0; c < 5; ++c) {
+            clusters.emplace_back(clusterCenter(rng), clusterCenter(rng), clusterCenter(rng));
+        }
+        
+        std::vector<CAABB> bounds;
+        for (size_t i = 0; i < count; ++i) {
+            const glm::vec3& cluster = clusters[i % clusters.size()];
+            glm::vec3 center(cluster.x + spread(rng), cluster.y + spread(rng), cluster.z + spread(rng));
+            bounds.push_back(createAABB(center, glm::vec3(size(rng))));
+        }
+        return bounds;
+    }
+
     glm::vec3 worldMin, worldMax;
     float cellSize;
     std::unique_ptr<SpatialPartitionStrategy> partition;
@@ -60,18 +107,39 @@ TEST_F(SpatialPartitionTest, Factory_CreatesUniformGrid) {
     EXPECT_TRUE(grid->isValid());
 }
 
-TEST_F(SpatialPartitionTest, Factory_CreatesQuadtreeStub) {
+TEST_F(SpatialPartitionTest, Factory_CreatesQuadtree) {
     auto quadtree = createSpatialPartition(PartitionType::QUADTREE, worldMin, worldMax, cellSize);
     
     ASSERT_NE(quadtree, nullptr);
-    EXPECT_STREQ(quadtree->getStrategyName(), "Quadtree (TODO)");
+    EXPECT_STREQ(quadtree->getStrategyName(), "Quadtree");
+    EXPECT_TRUE(quadtree->isValid());
 }
 
-TEST_F(SpatialPartitionTest, Factory_CreatesSpatialHashStub) {
+TEST_F(SpatialPartitionTest, Factory_CreatesSpatialHash) {
     auto hash = createSpatialPartition(PartitionType::SPATIAL_HASH, worldMin, worldMax, cellSize);
     
     ASSERT_NE(hash, nullptr);
-    EXPECT_STREQ(hash->getStrategyName(), "SpatialHash (TODO)");
+    EXPECT_STREQ(hash->getStrategyName(), "SpatialHash");
+    EXPECT_FALSE(hash->hasFixedBounds());
+    EXPECT_TRUE(hash->isValid());
+}
+
+TEST_F(SpatialPartitionTest, Factory_CreatesSweepAndPrune) {
+    auto sap = createSpatialPartition(PartitionType::SWEEP_AND_PRUNE, worldMin, worldMax, cellSize);
+    
+    ASSERT_NE(sap, nullptr);
+    EXPECT_STREQ(sap->getStrategyName(), "SweepAndPrune");
+    EXPECT_FALSE(sap->hasFixedBounds());
+    EXPECT_TRUE(sap->isValid());
+}
+
+TEST_F(SpatialPartitionTest, Factory_CreatesDynamicAABBTree) {
+    auto tree = createSpatialPartition(PartitionType::DYNAMIC_AABB_TREE, worldMin, worldMax, cellSize);
+    
+    ASSERT_NE(tree, nullptr);
+    EXPECT_STREQ(tree->getStrategyName(), "DynamicAABBTree");
+    EXPECT_FALSE(tree->hasFixedBounds());
+    EXPECT_TRUE(tree->isValid());
 }
 
 TEST_F(SpatialPartitionTest, Factory_HandlesUnknownType) {
@@ -434,4 +502,410 @@ TEST_F(SpatialPartitionTest, UniformGrid_EntityAtWorldBoundary) {
     auto results = partition->query(createAABB(worldMax, glm::vec3(1.0f)));
     EXPECT_EQ(results.size(), 1);
     EXPECT_EQ(results[0], entityId);
-}
\ No newline at end of file
+}
+
+TEST_F(SpatialPartitionTest, UniformGrid_FindCollisionsMatchesBruteForce) {
+    // Mixed sizes, many spanning several cells; keep only boxes inside the world
+    std::vector<CAABB> bounds;
+    for (const CAABB& b : createClusteredBounds(400, 11)) {
+        if (b.min.x >= worldMin.x && b.min.y >= worldMin.y && b.min.z >= worldMin.z &&
+            b.max.x <= worldMax.x && b.max.y <= worldMax.y && b.max.z <= worldMax.z) {
+            bounds.push_back(b);
+        }
+    }
+    ASSERT_GT(bounds.size(), 100u);
+    for (size_t i = 0; i < bounds.size(); ++i) {
+        partition->insert(i, bounds[i]);
+    }
+    
+    // Min-corner reporting must yield every overlapping pair exactly once
+    auto pairs = toPairSet(partition->findCollisions());
+    EXPECT_EQ(pairs, bruteForcePairs(bounds));
+    EXPECT_TRUE(partition->isValid());
+}
+
+TEST_F(SpatialPartitionTest, UniformGrid_SteadyStateFrameDoesNotAllocate) {
+    auto bounds = createClusteredBounds(200, 5);
+    for (size_t i = 0; i < bounds.size(); ++i) {
+        partition->insert(i, bounds[i]);
+    }
+    
+    std::vector<CollisionPair> pairs;
+    std::vector<EntityID> found;
+    CAABB region = createAABB(glm::vec3(0.0f), glm::vec3(4.0f));
+    
+    // Warm-up sizes the caller buffers and the query stamps
+    partition->findCollisions(pairs);
+    partition->query(region, found);
+    ASSERT_FALSE(pairs.empty());
+    
+    // Small moves that stay inside each box's cells, then the broadphase
+    size_t before = AllocationCounter::count();
+    for (size_t i = 0; i < bounds.size(); ++i) {
+        partition->update(i, bounds[i]);
+    }
+    partition->findCollisions(pairs);
+    partition->query(region, found);
+    EXPECT_EQ(AllocationCounter::count() - before, 0u);
+    
+    // The returning overload still allocates its result (and proves the counter is live)
+    before = AllocationCounter::count();
+    auto returned = partition->findCollisions();
+    EXPECT_GT(AllocationCounter::count() - before, 0u);
+    
+    EXPECT_EQ(toPairSet(pairs), toPairSet(returned));
+    EXPECT_FALSE(found.empty());
+}
+
+TEST_F(SpatialPartitionTest, UniformGrid_ParallelFindCollisionsMatchesSerialOrder) {
+    // Above PARALLEL_MIN_ENTITIES so the job system is actually used
+    auto bounds = createClusteredBounds(3000, 17);
+    for (size_t i = 0; i < bounds.size(); ++i) {
+        partition->insert(i, bounds[i]);
+    }
+    std::vector<CollisionPair> serial;
+    partition->findCollisions(serial);
+    PartitionStats serialStats;
+    partition->getStatistics(serialStats);
+    ASSERT_FALSE(serial.empty());
+    
+    JobSystem jobs(3);
+    partition->setJobSystem(&jobs);
+    std::vector<CollisionPair> parallel;
+    for (int frame = 0; frame < 3; ++frame) {
+        partition->findCollisions(parallel);
+        ASSERT_EQ(parallel, serial) << "frame " << frame; // Same pairs in the same order
+    }
+    PartitionStats parallelStats;
+    partition->getStatistics(parallelStats);
+    EXPECT_EQ(parallelStats.totalCollisionChecks, serialStats.totalCollisionChecks);
+    
+    // Per-chunk buffers and worker hand-off are reused once warmed up
+    size_t before = AllocationCounter::count();
+    partition->findCollisions(parallel);
+    EXPECT_EQ(AllocationCounter::count() - before, 0u);
+    
+    partition->setJobSystem(nullptr);
+}
+
+// ============================================================================
+// Quadtree
+// ============================================================================
+
+TEST_F(SpatialPartitionTest, Quadtree_InsertQueryAndRemove) {
+    auto quadtree = createSpatialPartition(PartitionType::QUADTREE, worldMin, worldMax, cellSize);
+    
+    quadtree->insert(1, createAABB(glm::vec3(-5.0f, -5.0f, 0.0f), glm::vec3(0.5f)));
+    quadtree->insert(2, createAABB(glm::vec3(5.0f, 5.0f, 0.0f), glm::vec3(0.5f)));
+    
+    auto results = quadtree->query(createAABB(glm::vec3(-5.0f, -5.0f, 0.0f), glm::vec3(1.0f)));
+    ASSERT_EQ(results.size(), 1);
+    EXPECT_EQ(results[0], 1);
+    
+    auto nearby = quadtree->queryRadius(glm::vec3(5.0f, 5.0f, 0.0f), 1.0f);
+    ASSERT_EQ(nearby.size(), 1);
+    EXPECT_EQ(nearby[0], 2);
+    
+    quadtree->remove(1);
+    EXPECT_TRUE(quadtree->query(createAABB(glm::vec3(-5.0f, -5.0f, 0.0f), glm::vec3(1.0f))).empty());
+    EXPECT_TRUE(quadtree->isValid());
+}
+
+TEST_F(SpatialPartitionTest, Quadtree_FindCollisionsMatchesBruteForce) {
+    auto quadtree = createSpatialPartition(PartitionType::QUADTREE, worldMin, worldMax, 0.5f);
+    auto bounds = createClusteredBounds(400, 42);
+    for (size_t i = 0; i < bounds.size(); ++i) {
+        quadtree->insert(i, bounds[i]);
+    }
+    ASSERT_TRUE(quadtree->isValid());
+    
+    EXPECT_EQ(toPairSet(quadtree->findCollisions()), bruteForcePairs(bounds));
+    
+    // Move every entity a little; most stay inside their loose node bounds
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> jitter(-0.3f, 0.3f);
+    for (size_t i = 0; i < bounds.size(); ++i) {
+        glm::vec3 offset(jitter(rng), jitter(rng), jitter(rng));
+        bounds[i].min += offset;
+        bounds[i].max += offset;
+        quadtree->update(i, bounds[i]);
+    }
+    ASSERT_TRUE(quadtree->isValid());
+    EXPECT_EQ(toPairSet(quadtree->findCollisions()), bruteForcePairs(bounds));
+}
+
+TEST_F(SpatialPartitionTest, Quadtree_SubdividesAndMerges) {
+    auto quadtree = createSpatialPartition(PartitionType::QUADTREE, worldMin, worldMax, 0.5f);
+    
+    // Dense cluster in one corner forces subdivision there only
+    for (EntityID id = 0; id < 64; ++id) {
+        glm::vec3 center(-8.0f + (id % 8) * 0.25f, -8.0f + (id / 8) * 0.25f, 0.0f);
+        quadtree->insert(id, createAABB(center, glm::vec3(0.05f)));
+    }
+    
+    PartitionStats stats;
+    quadtree->getStatistics(stats);
+    EXPECT_EQ(stats.totalEntities, 64);
+    EXPECT_GT(stats.totalNodes, 1);
+    EXPECT_GT(stats.maxDepth, 1);
+    EXPECT_LT(stats.maxEntitiesInSingleNode, 64);
+    EXPECT_TRUE(quadtree->isValid());
+    
+    // Removing most entities collapses the tree again
+    for (EntityID id = 0; id < 60; ++id) {
+        quadtree->remove(id);
+    }
+    quadtree->getStatistics(stats);
+    EXPECT_EQ(stats.totalEntities, 4);
+    EXPECT_EQ(stats.totalNodes, 1);
+    EXPECT_TRUE(quadtree->isValid());
+}
+
+TEST_F(SpatialPartitionTest, Quadtree_KeepsEntitiesOutsideWorld) {
+    auto quadtree = createSpatialPartition(PartitionType::QUADTREE, worldMin, worldMax, cellSize);
+    
+    quadtree->insert(1, createAABB(glm::vec3(50.0f, 0.0f, 0.0f), glm::vec3(1.0f)));
+    quadtree->insert(2, createAABB(glm::vec3(50.5f, 0.0f, 0.0f), glm::vec3(1.0f)));
+    
+    auto collisions = quadtree->findCollisions();
+    ASSERT_EQ(collisions.size(), 1);
+    EXPECT_EQ(quadtree->query(createAABB(glm::vec3(50.0f, 0.0f, 0.0f), glm::vec3(2.0f))).size(), 2);
+    
+    quadtree->clear();
+    EXPECT_TRUE(quadtree->findCollisions().empty());
+    EXPECT_TRUE(quadtree->isValid());
+}
+
+// ============================================================================
+// Spatial Hash
+// ============================================================================
+
+TEST_F(SpatialPartitionTest, SpatialHash_FindCollisionsMatchesBruteForce) {
+    auto hash = createSpatialPartition(PartitionType::SPATIAL_HASH, worldMin, worldMax, 0.75f);
+    auto bounds = createClusteredBounds(400, 11);
+    for (size_t i = 0; i < bounds.size(); ++i) {
+        hash->insert(i, bounds[i]);
+    }
+    ASSERT_TRUE(hash->isValid());
+    EXPECT_EQ(toPairSet(hash->findCollisions()), bruteForcePairs(bounds));
+    
+    // Move and remove some entities, then compare again
+    for (size_t i = 0; i < bounds.size(); i += 2) {
+        bounds[i].min.x += 0.6f;
+        bounds[i].max.x += 0.6f;
+        hash->update(i, bounds[i]);
+    }
+    for (size_t i = 1; i < bounds.size(); i += 3) {
+        hash->remove(i);
+        bounds[i] = createAABB(glm::vec3(1000.0f + i * 10.0f), glm::vec3(0.1f)); // Far away, never collides
+    }
+    ASSERT_TRUE(hash->isValid());
+    EXPECT_EQ(toPairSet(hash->findCollisions()), bruteForcePairs(bounds));
+}
+
+TEST_F(SpatialPartitionTest, SpatialHash_UnboundedWorld) {
+    auto hash = createSpatialPartition(PartitionType::SPATIAL_HASH, worldMin, worldMax, cellSize);
+    
+    // Far outside the nominal world, including negative coordinates
+    hash->insert(1, createAABB(glm::vec3(50000.0f, -30000.0f, 0.0f), glm::vec3(1.0f)));
+    hash->insert(2, createAABB(glm::vec3(50001.0f, -30000.0f, 0.0f), glm::vec3(1.0f)));
+    hash->insert(3, createAABB(glm::vec3(-80000.0f, 0.0f, 0.0f), glm::vec3(1.0f)));
+    
+    ASSERT_EQ(hash->findCollisions().size(), 1);
+    auto results = hash->query(createAABB(glm::vec3(-80000.0f, 0.0f, 0.0f), glm::vec3(2.0f)));
+    ASSERT_EQ(results.size(), 1);
+    EXPECT_EQ(results[0], 3);
+    
+    // Memory follows occupied cells, not world size (each box covers at most 2x2x2 cells)
+    PartitionStats stats;
+    hash->getStatistics(stats);
+    EXPECT_LE(stats.totalNodes, 3 * 8);
+    EXPECT_TRUE(hash->isValid());
+}
+
+TEST_F(SpatialPartitionTest, SpatialHash_EmptyCellsAreReleased) {
+    auto hash = createSpatialPartition(PartitionType::SPATIAL_HASH, worldMin, worldMax, cellSize);
+    
+    // One cell per entity, enough to force the key table to grow
+    for (EntityID id = 0; id < 2000; ++id) {
+        hash->insert(id, createAABB(glm::vec3(id * 4.0f + 1.0f, 1.0f, 1.0f), glm::vec3(0.1f)));
+    }
+    ASSERT_TRUE(hash->isValid());
+    
+    for (EntityID id = 0; id < 2000; id += 2) {
+        hash->remove(id);
+    }
+    ASSERT_TRUE(hash->isValid());
+    
+    PartitionStats stats;
+    hash->getStatistics(stats);
+    EXPECT_EQ(stats.totalEntities, 1000);
+    EXPECT_EQ(stats.totalNodes, 1000);
+    
+    auto results = hash->queryRadius(glm::vec3(5.0f, 1.0f, 1.0f), 1.0f);
+    ASSERT_EQ(results.size(), 1);
+    EXPECT_EQ(results[0], 1);
+    
+    hash->clear();
+    hash->getStatistics(stats);
+    EXPECT_EQ(stats.totalNodes, 0);
+    EXPECT_TRUE(hash->isValid());
+}
+
+// ============================================================================
+// Sweep and Prune
+// ============================================================================
+
+TEST_F(SpatialPartitionTest, SweepAndPrune_CoherentFramesMatchBruteForce) {
+    auto sap = createSpatialPartition(PartitionType::SWEEP_AND_PRUNE, worldMin, worldMax, cellSize);
+    auto bounds = createClusteredBounds(300, 21);
+    for (size_t i = 0; i < bounds.size(); ++i) {
+        sap->insert(i, bounds[i]);
+    }
+    ASSERT_TRUE(sap->isValid());
+    EXPECT_EQ(toPairSet(sap->findCollisions()), bruteForcePairs(bounds));
+    
+    // Several frames of small moves in both directions, resolved by insertion sort
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> step(-0.3f, 0.3f);
+    for (int frame = 0; frame < 10; ++frame) {
+        for (size_t i = 0; i < bounds.size(); ++i) {
+            glm::vec3 offset(step(rng), step(rng), step(rng));
+            bounds[i].min = bounds[i].min + offset;
+            bounds[i].max = bounds[i].max + offset;
+            sap->update(i, bounds[i]);
+        }
+        ASSERT_TRUE(sap->isValid()) << "frame " << frame;
+        EXPECT_EQ(toPairSet(sap->findCollisions()), bruteForcePairs(bounds)) << "frame " << frame;
+    }
+}
+
+TEST_F(SpatialPartitionTest, SweepAndPrune_RemoveQueryAndTouchingBoxes) {
+    auto sap = createSpatialPartition(PartitionType::SWEEP_AND_PRUNE, worldMin, worldMax, cellSize);
+    
+    // 1 and 2 touch on X (no collision), 2 and 3 overlap, 4 is far outside the world
+    sap->insert(1, createAABB(glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(1.0f)));
+    sap->insert(2, createAABB(glm::vec3(2.0f, 0.0f, 0.0f), glm::vec3(1.0f)));
+    sap->insert(3, createAABB(glm::vec3(2.5f, 0.5f, 0.0f), glm::vec3(1.0f)));
+    sap->insert(4, createAABB(glm::vec3(500.0f, 0.0f, 0.0f), glm::vec3(1.0f)));
+    
+    auto collisions = toPairSet(sap->findCollisions());
+    EXPECT_EQ(collisions, (std::set<CollisionPair>{{2, 3}}));
+    EXPECT_EQ(sap->query(createAABB(glm::vec3(500.0f, 0.0f, 0.0f), glm::vec3(0.5f))).size(), 1);
+    
+    sap->remove(2);
+    EXPECT_TRUE(sap->findCollisions().empty());
+    EXPECT_TRUE(sap->isValid());
+    
+    auto results = sap->queryRadius(glm::vec3(2.5f, 0.5f, 0.0f), 0.5f);
+    ASSERT_EQ(results.size(), 1);
+    EXPECT_EQ(results[0], 3);
+    
+    PartitionStats stats;
+    sap->getStatistics(stats);
+    EXPECT_EQ(stats.totalEntities, 3);
+    EXPECT_EQ(stats.totalNodes, 6);
+}
+
+TEST_F(SpatialPartitionTest, DegenerateBoxes_AllStrategiesMatchBruteForce) {
+    // Point and flat boxes (zero width on one or more axes) inside a larger box
+    std::vector<CAABB> bounds = {
+        createAABB(glm::vec3(4.0f), glm::vec3(4.0f)),                        // [0,8]^3
+        createAABB(glm::vec3(5.0f), glm::vec3(0.0f)),                        // Point inside 0
+        createAABB(glm::vec3(2.0f, 3.0f, 3.0f), glm::vec3(0.0f, 1.0f, 1.0f)), // Flat on X
+        createAABB(glm::vec3(3.0f, 2.0f, 3.0f), glm::vec3(1.0f, 0.0f, 1.0f)), // Flat on Y
+        createAABB(glm::vec3(3.0f, 3.0f, 2.0f), glm::vec3(1.0f, 1.0f, 0.0f)), // Flat on Z
+        createAABB(glm::vec3(0.0f, 4.0f, 4.0f), glm::vec3(0.0f)),            // Point on 0's face
+        createAABB(glm::vec3(-5.0f), glm::vec3(0.0f)),                       // Point outside
+    };
+    const std::set<CollisionPair> expected = bruteForcePairs(bounds);
+    ASSERT_TRUE(expected.count(CollisionPair(0, 1)));
+    
+    for (PartitionType type : {PartitionType::UNIFORM_GRID, PartitionType::QUADTREE,
+                               PartitionType::SPATIAL_HASH, PartitionType::SWEEP_AND_PRUNE,
+                               PartitionType::DYNAMIC_AABB_TREE}) {
+        auto strategy = createSpatialPartition(type, worldMin, worldMax, cellSize);
+        for (size_t i = 0; i < bounds.size(); ++i) {
+            strategy->insert(i, bounds[i]);
+        }
+        EXPECT_EQ(toPairSet(strategy->findCollisions()), expected) << strategy->getStrategyName();
+    }
+}
+
+// ============================================================================
+// Dynamic AABB Tree
+// ============================================================================
+
+TEST_F(SpatialPartitionTest, DynamicTree_MixedSizesMatchBruteForce) {
+    auto tree = createSpatialPartition(PartitionType::DYNAMIC_AABB_TREE, worldMin, worldMax, cellSize);
+    
+    // Small clustered boxes plus a few huge ones spanning most of the world
+    auto bounds = createClusteredBounds(300, 31);
+    bounds.push_back(createAABB(glm::vec3(0.0f), glm::vec3(8.0f, 0.5f, 8.0f)));
+    bounds.push_back(createAABB(glm::vec3(-5.0f, 2.0f, 0.0f), glm::vec3(0.5f, 9.0f, 9.0f)));
+    for (size_t i = 0; i < bounds.size(); ++i) {
+        tree->insert(i, bounds[i]);
+    }
+    ASSERT_TRUE(tree->isValid());
+    EXPECT_EQ(toPairSet(tree->findCollisions()), bruteForcePairs(bounds));
+    
+    // Small moves stay inside fat bounds, large ones force reinsertion
+    std::mt19937 rng(8);
+    std::uniform_real_distribution<float> smallStep(-0.05f, 0.05f);
+    std::uniform_real_distribution<float> largeStep(-3.0f, 3.0f);
+    for (int frame = 0; frame < 5; ++frame) {
+        for (size_t i = 0; i < bounds.size(); ++i) {
+            float d = (i % 4 == 0) ? largeStep(rng) : smallStep(rng);
+            glm::vec3 offset(d, -d, 0.5f * d);
+            bounds[i].min = bounds[i].min + offset;
+            bounds[i].max = bounds[i].max + offset;
+            tree->update(i, bounds[i]);
+        }
+        ASSERT_TRUE(tree->isValid()) << "frame " << frame;
+        EXPECT_EQ(toPairSet(tree->findCollisions()), bruteForcePairs(bounds)) << "frame " << frame;
+    }
+    
+    // Queries use tight bounds, not fat ones
+    CAABB region = createAABB(glm::vec3(2.0f, -3.0f, 1.0f), glm::vec3(2.5f));
+    std::set<EntityID> expected;
+    for (size_t i = 0; i < bounds.size(); ++i) {
+        if (AABBUtils::intersects(bounds[i], region)) {
+            expected.insert(i);
+        }
+    }
+    auto results = tree->query(region);
+    EXPECT_EQ(std::set<EntityID>(results.begin(), results.end()), expected);
+}
+
+TEST_F(SpatialPartitionTest, DynamicTree_SortedInsertionStaysShallow) {
+    auto tree = createSpatialPartition(PartitionType::DYNAMIC_AABB_TREE, worldMin, worldMax, cellSize);
+    
+    // Worst case for an unbalanced BVH: a long sorted row
+    const EntityID count = 1024;
+    for (EntityID id = 0; id < count; ++id) {
+        tree->insert(id, createAABB(glm::vec3(id * 1.0f, 0.0f, 0.0f), glm::vec3(0.4f)));
+    }
+    ASSERT_TRUE(tree->isValid());
+    
+    PartitionStats stats;
+    tree->getStatistics(stats);
+    EXPECT_EQ(stats.totalEntities, count);
+    EXPECT_EQ(stats.totalNodes, 2 * count - 1);
+    EXPECT_LE(stats.maxDepth, 24u); // log2(1024) = 10; a degenerate chain would be 1024
+    
+    for (EntityID id = 0; id < count; id += 2) {
+        tree->remove(id);
+    }
+    ASSERT_TRUE(tree->isValid());
+    tree->getStatistics(stats);
+    EXPECT_EQ(stats.totalNodes, count - 1);
+    EXPECT_LE(stats.maxDepth, 24u);
+    
+    auto results = tree->queryRadius(glm::vec3(501.0f, 0.0f, 0.0f), 0.5f);
+    ASSERT_EQ(results.size(), 1);
+    EXPECT_EQ(results[0], 501);
+    
+    tree->clear();
+    EXPECT_TRUE(tree->findCollisions().empty());
+    EXPECT_TRUE(tree->isValid());
+}
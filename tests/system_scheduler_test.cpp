@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+#include "../include/SystemScheduler.hpp"
+#include "../include/JobSystem.hpp"
+#include "../include/Component.h"
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * Unit tests for SystemScheduler
+ *
+ * The DAG must order exactly the conflicting systems (reduced to direct
+ * edges), place independent systems on the same level, respect every
+ * edge when running on a job system, and match registration order when
+ * running without one.
+ */
+
+TEST(SystemSchedulerTest, ConflictsFollowReadWriteRules) {
+    SystemAccess readsTransform = SystemAccess().reads<CTransform3D>();
+    SystemAccess writesTransform = SystemAccess().writes<CTransform3D>();
+    SystemAccess writesMovement = SystemAccess().writes<CMovement3D>();
+
+    EXPECT_FALSE(readsTransform.conflictsWith(SystemAccess().reads<CTransform3D>()));
+    EXPECT_TRUE(readsTransform.conflictsWith(writesTransform));
+    EXPECT_TRUE(writesTransform.conflictsWith(readsTransform));
+    EXPECT_TRUE(writesTransform.conflictsWith(writesTransform));
+    EXPECT_FALSE(writesTransform.conflictsWith(writesMovement));
+
+    SystemAccess producer = SystemAccess().writesResource("collisions");
+    SystemAccess consumer = SystemAccess().readsResource("collisions");
+    EXPECT_TRUE(producer.conflictsWith(consumer));
+    EXPECT_FALSE(consumer.conflictsWith(SystemAccess().readsResource("collisions")));
+
+    EXPECT_TRUE(SystemAccess().exclusive().conflictsWith(SystemAccess()));
+
+    // Profiling output names components as written in the source
+    EXPECT_EQ(SystemAccess().reads<CAABB>().writes<CTransform3D>().readsResource("collisions").describe(),
+              "reads CAABB $collisions; writes CTransform3D");
+    EXPECT_FALSE(SystemAccess().conflictsWith(SystemAccess()));
+}
+
+TEST(SystemSchedulerTest, GraphKeepsOnlyDirectDependencies) {
+    SystemScheduler scheduler;
+    auto noop = [](float) {};
+    size_t movement = scheduler.addSystem("movement", SystemAccess().writes<CTransform3D, CMovement3D>(), noop);
+    size_t lifespan = scheduler.addSystem("lifespan", SystemAccess().writes<CLifespan>(), noop);
+    size_t bounds = scheduler.addSystem("bounds", SystemAccess().reads<CTransform3D>().writes<CAABB>(), noop);
+    size_t render = scheduler.addSystem("render", SystemAccess().reads<CTransform3D, CLifespan, CAABB>(), noop);
+
+    EXPECT_TRUE(scheduler.getDependencies(movement).empty());
+    EXPECT_TRUE(scheduler.getDependencies(lifespan).empty());
+    EXPECT_EQ(scheduler.getDependencies(bounds), (std::vector<size_t>{movement}));
+    // render -> movement is implied through bounds and dropped
+    EXPECT_EQ(scheduler.getDependencies(render), (std::vector<size_t>{lifespan, bounds}));
+
+    EXPECT_EQ(scheduler.getStats(movement).level, 0u);
+    EXPECT_EQ(scheduler.getStats(lifespan).level, 0u);
+    EXPECT_EQ(scheduler.getStats(bounds).level, 1u);
+    EXPECT_EQ(scheduler.getStats(render).level, 2u);
+
+    std::string dump = scheduler.getScheduleDump();
+    EXPECT_NE(dump.find("4 systems, 3 levels"), std::string::npos) << dump;
+    EXPECT_NE(dump.find("after [lifespan, bounds]"), std::string::npos) << dump;
+}
+
+TEST(SystemSchedulerTest, RunRespectsDependenciesOnWorkers) {
+    JobSystem jobs(3);
+    SystemScheduler scheduler;
+    scheduler.setJobSystem(&jobs);
+
+    // Four independent writers, a reader per pair of them, then an exclusive sink
+    std::mutex orderMutex;
+    std::vector<size_t> order;
+    auto record = [&](size_t system) {
+        return [&, system](float) {
+            std::lock_guard<std::mutex> lock(orderMutex);
+            order.push_back(system);
+        };
+    };
+    std::vector<SystemAccess> accesses = {
+        SystemAccess().writesResource("a"), SystemAccess().writesResource("b"),
+        SystemAccess().writesResource("c"), SystemAccess().writesResource("d"),
+        SystemAccess().readsResource("a").readsResource("b"),
+        SystemAccess().readsResource("c").readsResource("d"),
+        SystemAccess().exclusive()};
+    for (size_t i = 0; i < accesses.size(); ++i) {
+        scheduler.addSystem("s" + std::to_string(i), accesses[i], record(i));
+    }
+
+    for (int frame = 0; frame < 200; ++frame) {
+        order.clear();
+        scheduler.run(0.016f);
+        ASSERT_EQ(order.size(), accesses.size());
+
+        std::vector<size_t> position(order.size());
+        for (size_t i = 0; i < order.size(); ++i) {
+            position[order[i]] = i;
+        }
+        for (size_t system = 0; system < accesses.size(); ++system) {
+            for (size_t dependency : scheduler.getDependencies(system)) {
+                ASSERT_LT(position[dependency], position[system])
+                    << "frame " << frame << ": s" << dependency << " before s" << system;
+            }
+        }
+    }
+    EXPECT_EQ(scheduler.getStats(6).level, 2u);
+    EXPECT_LT(scheduler.getStats(6).lastThread, jobs.getThreadCount());
+}
+
+TEST(SystemSchedulerTest, RunWithoutWorkersUsesRegistrationOrder) {
+    SystemScheduler scheduler;
+    std::vector<int> order;
+    for (int i = 0; i < 4; ++i) {
+        scheduler.addSystem("s" + std::to_string(i), SystemAccess(), [&order, i](float) { order.push_back(i); });
+    }
+    scheduler.run(0.0f);
+    EXPECT_EQ(order, (std::vector<int>{0, 1, 2, 3}));
+
+    JobSystem inlineJobs(0);
+    scheduler.setJobSystem(&inlineJobs);
+    scheduler.run(0.0f);
+    EXPECT_EQ(order, (std::vector<int>{0, 1, 2, 3, 0, 1, 2, 3}));
+}
@@ -5,7 +5,9 @@
 #include "../include/MovementSystem.hpp"
 #include "../include/EntityManager.h"
 #include "../include/Constants.hpp"
+#include "../include/JobSystem.hpp"
 #include <glm/glm.hpp>
+#include <cmath>
 
 class SystemsTest : public ::testing::Test {
 protected:
@@ -105,6 +107,32 @@ TEST_F(SystemsTest, MovementSystem_SpeedLimit) {
     EXPECT_FLOAT_EQ(speed, 5.0f);
 }
 
+TEST_F(SystemsTest, MovementSystem_RecycledIdDropsPreviousEntityState) {
+    auto entity = entityManager->addEntity(EntityTag::TRIANGLE);
+    entity->add<CTransform3D>(glm::vec3(0.0f), glm::vec3(0.0f), glm::vec3(1.0f));
+    entity->add<CMovement3D>(glm::vec3(10.0f, 0.0f, 0.0f), glm::vec3(0.0f));
+    entityManager->update();
+    
+    // Limit and force left behind by an entity that is then destroyed
+    movementSystem->setMaxSpeed(entity, 1.0f);
+    movementSystem->addForce(entity, glm::vec3(0.0f, 100.0f, 0.0f));
+    const size_t oldID = entity->id();
+    entity->destroy();
+    entityManager->update();
+    
+    // The next entity takes the same slot
+    auto reused = entityManager->addEntity(EntityTag::TRIANGLE);
+    ASSERT_EQ(reused->id(), oldID);
+    reused->add<CTransform3D>(glm::vec3(0.0f), glm::vec3(0.0f), glm::vec3(1.0f));
+    reused->add<CMovement3D>(glm::vec3(10.0f, 0.0f, 0.0f), glm::vec3(0.0f));
+    entityManager->update();
+    
+    movementSystem->updateMovement(*entityManager, 1.0f);
+    const auto& movement = reused->get<CMovement3D>();
+    EXPECT_FLOAT_EQ(movement.vel.x, 10.0f); // Not capped
+    EXPECT_FLOAT_EQ(movement.vel.y, 0.0f);  // Not pushed
+}
+
 // ============================================================================
 // BoundarySystem Tests
 // ============================================================================
@@ -216,6 +244,39 @@ TEST_F(SystemsTest, CollisionDetectionSystem_EntityCollisionDetection) {
     EXPECT_EQ(collisions[0].entityB->id(), entity2->id());
 }
 
+TEST_F(SystemsTest, CollisionDetectionSystem_BroadphaseMatchesBruteForce) {
+    // Row of unit boxes spaced 0.75 apart, spanning several grid cells
+    std::vector<std::shared_ptr<Entity>> entities;
+    for (int i = 0; i < 40; ++i) {
+        auto entity = entityManager->addEntity(EntityTag::TRIANGLE);
+        entity->add<CTransform3D>(glm::vec3(-15.0f + i * 0.75f, 0.0f, 0.0f), glm::vec3(0.0f), glm::vec3(1.0f));
+        entity->add<CAABB>(glm::vec3(0.0f), glm::vec3(0.5f));
+        entities.push_back(entity);
+    }
+    entityManager->update();
+
+    auto collisions = collisionDetectionSystem->detectCollisions(*entityManager);
+
+    // Brute-force reference over the updated AABBs
+    size_t expected = 0;
+    for (size_t i = 0; i < entities.size(); ++i) {
+        for (size_t j = i + 1; j < entities.size(); ++j) {
+            if (collisionDetectionSystem->checkAABBCollision(entities[i]->get<CAABB>(), entities[j]->get<CAABB>())) {
+                expected++;
+            }
+        }
+    }
+    ASSERT_EQ(collisions.size(), expected);
+    EXPECT_EQ(expected, 39u); // Only neighbours overlap
+
+    for (size_t i = 0; i < collisions.size(); ++i) {
+        EXPECT_LT(collisions[i].entityA->id(), collisions[i].entityB->id());
+        if (i > 0) {
+            EXPECT_LT(collisions[i - 1].entityA->id(), collisions[i].entityA->id());
+        }
+    }
+}
+
 // ============================================================================
 // CollisionResolutionSystem Tests
 // ============================================================================
@@ -302,6 +363,60 @@ TEST_F(SystemsTest, Integration_MovementAndBoundarySystem) {
     EXPECT_LT(movement.vel.x, 0.0f);
 }
 
+TEST_F(SystemsTest, Integration_JobSystemMatchesSingleThreaded) {
+    // Same start state stepped with and without a job system ends in the same state
+    for (int i = 0; i < 3000; ++i) {
+        float f = static_cast<float>(i);
+        auto entity = entityManager->addEntity(EntityTag::TRIANGLE);
+        entity->add<CTransform3D>(glm::vec3(std::fmod(f * 0.37f, 18.0f) - 9.0f,
+                                            std::fmod(f * 0.53f, 18.0f) - 9.0f, 0.0f),
+                                  glm::vec3(0.0f), glm::vec3(1.0f));
+        entity->add<CMovement3D>(glm::vec3(std::fmod(f, 7.0f) - 3.0f, std::fmod(f, 5.0f) - 2.0f, 0.0f),
+                                 glm::vec3(0.0f, -1.0f, 0.0f));
+    }
+    entityManager->update();
+    const auto& entities = entityManager->getEntities();
+    movementSystem->setMaxSpeed(entities[5], 1.0f);
+    
+    std::vector<CTransform3D> startTransforms;
+    std::vector<CMovement3D> startMovements;
+    for (const auto& entity : entities) {
+        startTransforms.push_back(entity->get<CTransform3D>());
+        startMovements.push_back(entity->get<CMovement3D>());
+    }
+    auto step = [&]() {
+        for (int frame = 0; frame < 30; ++frame) {
+            movementSystem->addForce(entities[frame], glm::vec3(1.0f, 2.0f, 0.0f));
+            movementSystem->updateMovement(*entityManager, 0.1f);
+            boundarySystem->enforceBoundaries(*entityManager);
+        }
+    };
+    
+    step();
+    std::vector<CTransform3D> serialTransforms;
+    std::vector<CMovement3D> serialMovements;
+    for (size_t i = 0; i < entities.size(); ++i) {
+        serialTransforms.push_back(entities[i]->get<CTransform3D>());
+        serialMovements.push_back(entities[i]->get<CMovement3D>());
+        entities[i]->get<CTransform3D>() = startTransforms[i];
+        entities[i]->get<CMovement3D>() = startMovements[i];
+    }
+    
+    JobSystem jobs(3);
+    movementSystem->setJobSystem(&jobs);
+    boundarySystem->setJobSystem(&jobs);
+    step();
+    
+    for (size_t i = 0; i < entities.size(); ++i) {
+        ASSERT_EQ(entities[i]->get<CTransform3D>().position, serialTransforms[i].position) << "entity " << i;
+        ASSERT_EQ(entities[i]->get<CTransform3D>().rotation, serialTransforms[i].rotation) << "entity " << i;
+        ASSERT_EQ(entities[i]->get<CMovement3D>().vel, serialMovements[i].vel) << "entity " << i;
+    }
+    
+    movementSystem->setJobSystem(nullptr);
+    boundarySystem->setJobSystem(nullptr);
+}
+
 TEST_F(SystemsTest, Integration_FullPhysicsLoop) {
     // Create two entities that will collide
     auto entity1 = entityManager->addEntity(EntityTag::TRIANGLE);
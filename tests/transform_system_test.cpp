@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include "../include/TransformSystem.hpp"
+#include "../include/MovementSystem.hpp"
+#include "../include/TransformInterpolator.hpp"
+#include "../include/EntityManager.h"
+#include "../include/JobSystem.hpp"
+#include <glm/glm.hpp>
+
+/**
+ * Unit tests for cached model matrices
+ *
+ * New transforms start dirty, the pass rebuilds only dirty entities and
+ * clears the flag, writers (MovementSystem here) set it again, and the
+ * interpolator reports when the cached matrix can be drawn unchanged.
+ */
+
+namespace {
+void expectMatrixEq(const glm::mat4& actual, const glm::mat4& expected) {
+    for (int column = 0; column < 4; ++column) {
+        for (int row = 0; row < 4; ++row) {
+            EXPECT_FLOAT_EQ(actual[column][row], expected[column][row])
+                << "column " << column << " row " << row;
+        }
+    }
+}
+} // namespace
+
+TEST(TransformSystemTest, RebuildsOnlyDirtyTransforms) {
+    EntityManager entityManager;
+    auto moving = entityManager.addEntity(EntityTag::TRIANGLE);
+    moving->add<CTransform3D>(glm::vec3(1.0f, 2.0f, 3.0f), glm::vec3(0.0f, 45.0f, 0.0f), glm::vec3(2.0f));
+    moving->add<CMovement3D>(glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(0.0f));
+    moving->add<CModelMatrix>();
+    auto still = entityManager.addEntity(EntityTag::TRIANGLE);
+    still->add<CTransform3D>(glm::vec3(-4.0f), glm::vec3(10.0f), glm::vec3(1.0f));
+    still->add<CModelMatrix>();
+    auto uncached = entityManager.addEntity(EntityTag::TRIANGLE);
+    uncached->add<CTransform3D>(glm::vec3(0.0f), glm::vec3(0.0f), glm::vec3(1.0f));
+    entityManager.update();
+
+    TransformSystem transforms;
+    EXPECT_EQ(transforms.updateModelMatrices(entityManager), 2u);
+    EXPECT_FALSE(moving->get<CTransform3D>().dirty);
+    EXPECT_FALSE(still->get<CTransform3D>().dirty);
+    EXPECT_TRUE(uncached->get<CTransform3D>().dirty); // No CModelMatrix to fill
+    const auto& stillTransform = still->get<CTransform3D>();
+    expectMatrixEq(still->get<CModelMatrix>().matrix,
+                   TransformSystem::modelMatrix(stillTransform.position, stillTransform.rotation,
+                                                stillTransform.scale));
+
+    // Nothing written since: nothing rebuilt
+    EXPECT_EQ(transforms.updateModelMatrices(entityManager), 0u);
+
+    // A movement tick dirties only the mover
+    MovementSystem movement;
+    movement.updateMovement(entityManager, 0.5f);
+    EXPECT_TRUE(moving->get<CTransform3D>().dirty);
+    EXPECT_FALSE(still->get<CTransform3D>().dirty);
+
+    JobSystem jobs(2);
+    transforms.setJobSystem(&jobs);
+    EXPECT_EQ(transforms.updateModelMatrices(entityManager), 1u);
+    const auto& movedTransform = moving->get<CTransform3D>();
+    EXPECT_FLOAT_EQ(movedTransform.position.x, 1.5f);
+    expectMatrixEq(moving->get<CModelMatrix>().matrix,
+                   TransformSystem::modelMatrix(movedTransform.position, movedTransform.rotation,
+                                                movedTransform.scale));
+}
+
+TEST(TransformSystemTest, InterpolatorRendersCurrentOnlyForUnmovedEntities) {
+    EntityManager entityManager;
+    auto moving = entityManager.addEntity(EntityTag::TRIANGLE);
+    moving->add<CTransform3D>(glm::vec3(0.0f), glm::vec3(0.0f), glm::vec3(1.0f));
+    auto still = entityManager.addEntity(EntityTag::TRIANGLE);
+    still->add<CTransform3D>(glm::vec3(3.0f), glm::vec3(0.0f), glm::vec3(1.0f));
+    entityManager.update();
+
+    TransformInterpolator interpolator;
+    interpolator.capture(entityManager);
+    moving->get<CTransform3D>().position.x = 1.0f;
+
+    interpolator.setAlpha(0.5f);
+    EXPECT_FALSE(interpolator.rendersCurrent(moving->id(), moving->get<CTransform3D>()));
+    EXPECT_TRUE(interpolator.rendersCurrent(still->id(), still->get<CTransform3D>()));
+
+    // At alpha 1 everything renders its latest state
+    interpolator.setAlpha(1.0f);
+    EXPECT_TRUE(interpolator.rendersCurrent(moving->id(), moving->get<CTransform3D>()));
+}